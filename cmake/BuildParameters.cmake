@@ -14,6 +14,7 @@ optional_system_library(zstd)
 optional_system_library(libzip)
 set(CMAKE_MSVC_RUNTIME_LIBRARY "MultiThreaded$<$<CONFIG:Debug>:Debug>")
 option(LTO_PCSX2_CORE "Enable LTO/IPO/LTCG on the subset of pcsx2 that benefits most from it but not anything else")
+option(BUILD_CDVD_TRACE_REPLAY "Build the tool for replaying disc read traces (see CdvdTrace)" OFF)
 #-------------------------------------------------------------------------------
 # Graphical option
 #-------------------------------------------------------------------------------
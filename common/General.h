@@ -53,6 +53,19 @@ namespace HostSys
 
 	extern void MemProtect(void* baseaddr, size_t size, const PageProtectionMode mode);
 
+	/// Asks the OS to back the 2MB-aligned portion of the range with transparent huge pages.
+	/// Shared memory mappings are governed by a separate kernel setting from anonymous ones, so the
+	/// caller has to say which the range is. Returns false if huge pages are unavailable for that
+	/// kind of mapping, in which case normal pages remain in use.
+	extern bool AdviseHugePages(void* baseaddr, size_t size, bool shared);
+
+	/// Returns how much of the range is currently backed by huge pages, going by the kernel's
+	/// per-mapping accounting, or 0 where that isn't available.
+	extern size_t GetHugePageBackedSize(const void* baseaddr, size_t size);
+
+	/// Returns the amount of physical memory installed in the host, or 0 if it can't be determined.
+	extern u64 GetTotalPhysicalMemory();
+
 	extern std::string GetFileMappingName(const char* prefix);
 	extern void* CreateSharedMemory(const char* name, size_t size);
 	extern void DestroySharedMemory(void* ptr);
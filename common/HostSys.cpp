@@ -32,6 +32,9 @@
 #define off64_t off_t
 #endif
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <mutex>
 
 #include <fmt/format.h>
@@ -329,6 +332,100 @@ void HostSys::MemProtect(void* baseaddr, size_t size, const PageProtectionMode m
 #endif
 }
 
+#if defined(__linux__)
+static bool TransparentHugePagesAvailable(const char* path)
+{
+	// "[never]" (or "[deny]" for shmem) means madvise() will succeed but the kernel won't ever
+	// use huge pages for the range.
+	std::FILE* fp = std::fopen(path, "r");
+	if (!fp)
+		return false;
+
+	char buf[128] = {};
+	const bool read = (std::fgets(buf, sizeof(buf), fp) != nullptr);
+	std::fclose(fp);
+	return read && std::strstr(buf, "[never]") == nullptr && std::strstr(buf, "[deny]") == nullptr;
+}
+#endif
+
+bool HostSys::AdviseHugePages(void* baseaddr, size_t size, bool shared)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	static constexpr uptr HUGE_PAGE_SIZE = 2 * _1mb;
+
+	// Anonymous mappings follow "enabled", shm_open()/memfd mappings follow "shmem_enabled",
+	// which defaults to never.
+	static const bool anon_available = TransparentHugePagesAvailable("/sys/kernel/mm/transparent_hugepage/enabled");
+	static const bool shmem_available = TransparentHugePagesAvailable("/sys/kernel/mm/transparent_hugepage/shmem_enabled");
+
+	const uptr start = Common::AlignUpPow2(reinterpret_cast<uptr>(baseaddr), HUGE_PAGE_SIZE);
+	const uptr end = Common::AlignDownPow2(reinterpret_cast<uptr>(baseaddr) + size, HUGE_PAGE_SIZE);
+	if (!baseaddr || end <= start || !(shared ? shmem_available : anon_available))
+		return false;
+
+	return (madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) == 0);
+#else
+	// Windows large pages need SeLockMemoryPrivilege and must be requested at allocation time,
+	// and macOS has no equivalent for user mappings.
+	return false;
+#endif
+}
+
+size_t HostSys::GetHugePageBackedSize(const void* baseaddr, size_t size)
+{
+#if defined(__linux__)
+	std::FILE* fp = std::fopen("/proc/self/smaps", "r");
+	if (!fp)
+		return 0;
+
+	// smaps only counts huge pages per mapping, so a mapping which is only partly inside the
+	// range contributes in proportion to the overlap.
+	const uptr range_start = reinterpret_cast<uptr>(baseaddr);
+	const uptr range_end = range_start + size;
+	uptr vma_start = 0, vma_end = 0;
+	u64 backed = 0;
+
+	char line[256];
+	while (std::fgets(line, sizeof(line), fp))
+	{
+		unsigned long long start, end, kb;
+		if (std::sscanf(line, "%llx-%llx ", &start, &end) == 2)
+		{
+			vma_start = static_cast<uptr>(start);
+			vma_end = static_cast<uptr>(end);
+			continue;
+		}
+
+		if (vma_end <= range_start || vma_start >= range_end)
+			continue;
+
+		if (std::sscanf(line, "AnonHugePages: %llu kB", &kb) != 1 && std::sscanf(line, "ShmemPmdMapped: %llu kB", &kb) != 1)
+			continue;
+
+		const u64 overlap = std::min(vma_end, range_end) - std::max(vma_start, range_start);
+		backed += static_cast<u64>(static_cast<double>(kb) * 1024.0 * static_cast<double>(overlap) / static_cast<double>(vma_end - vma_start));
+	}
+
+	std::fclose(fp);
+	return static_cast<size_t>(std::min<u64>(backed, size));
+#else
+	return 0;
+#endif
+}
+
+u64 HostSys::GetTotalPhysicalMemory()
+{
+#if defined(_WIN32)
+	MEMORYSTATUSEX status = {};
+	status.dwLength = sizeof(status);
+	return GlobalMemoryStatusEx(&status) ? static_cast<u64>(status.ullTotalPhys) : 0;
+#else
+	const long pages = sysconf(_SC_PHYS_PAGES);
+	const long page_size = sysconf(_SC_PAGESIZE);
+	return (pages > 0 && page_size > 0) ? static_cast<u64>(pages) * static_cast<u64>(page_size) : 0;
+#endif
+}
+
 std::string HostSys::GetFileMappingName(const char* prefix)
 {
 #if defined(_WIN32)
@@ -14,6 +14,7 @@
 */
 
 #include "common/Threading.h"
+#include "common/VectorIntrin.h"
 
 #ifdef _WIN32
 #include "common/RedtapeWindows.h"
@@ -29,6 +30,7 @@
 #include <mach/mach_time.h> // mach_absolute_time()
 #endif
 
+#include <algorithm>
 #include <limits>
 
 // --------------------------------------------------------------------------------------
@@ -79,6 +81,65 @@ void Threading::WorkSema::WaitForWork()
 	}
 }
 
+static __fi void ShortSpin()
+{
+#if defined(_M_X86)
+	_mm_pause();
+#elif defined(_M_ARM64) && defined(_MSC_VER)
+	__isb(_ARM64_BARRIER_SY);
+#elif defined(_M_ARM64)
+	__asm__ __volatile__("isb");
+#endif
+}
+
+void Threading::WorkSema::WaitForWorkWithSpin()
+{
+	// Same as WaitForWork, but instead of going straight to SLEEPING we try SPINNING first
+	s32 value = m_state.load(std::memory_order_relaxed);
+	while (!m_state.compare_exchange_weak(value, NextStateWaitForWork(value), std::memory_order_acq_rel, std::memory_order_relaxed))
+		;
+
+	s32 waiting_empty_cleared = value & (STATE_FLAG_WAITING_EMPTY - 1);
+	if (waiting_empty_cleared != STATE_RUNNING_0)
+		return;
+
+	if (value & STATE_FLAG_WAITING_EMPTY)
+		m_empty_sema.Post();
+
+	// SLEEPING -> SPINNING. If this fails, work was added and m_sema was posted, so fall through to consume it.
+	value = STATE_SLEEPING;
+	if (m_state.compare_exchange_strong(value, STATE_SPINNING, std::memory_order_relaxed))
+	{
+		u32 spins = 0;
+		u32 backoff = 1;
+		while (spins < m_spin_budget)
+		{
+			// NotifyOfWork moves SPINNING -> RUNNING without posting the semaphore
+			if (m_state.load(std::memory_order_acquire) != STATE_SPINNING)
+			{
+				m_spin_budget = std::min(m_spin_budget * 2, MAX_SPIN_BUDGET);
+				return;
+			}
+
+			for (u32 i = 0; i < backoff; i++)
+				ShortSpin();
+			spins += backoff;
+			backoff = std::min<u32>(backoff * 2, 64);
+		}
+
+		// Nothing showed up, spin less next time
+		m_spin_budget = std::max(m_spin_budget / 2, MIN_SPIN_BUDGET);
+
+		value = STATE_SPINNING;
+		if (!m_state.compare_exchange_strong(value, STATE_SLEEPING, std::memory_order_acquire))
+			return;
+	}
+
+	m_sema.Wait();
+	// Acknowledge any additional work added between wake up request and getting here
+	m_state.fetch_and(STATE_FLAG_WAITING_EMPTY, std::memory_order_acquire);
+}
+
 bool Threading::WorkSema::WaitForEmpty()
 {
 	s32 value = m_state.load(std::memory_order_acquire);
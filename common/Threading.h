@@ -141,6 +141,11 @@ namespace Threading
 		KernelSemaphore m_empty_sema;
 		/// Current state (see enum below)
 		std::atomic<s32> m_state{0};
+		/// Number of spin iterations WaitForWorkWithSpin will try before sleeping (only touched by the worker thread)
+		u32 m_spin_budget = MAX_SPIN_BUDGET;
+
+		static constexpr u32 MIN_SPIN_BUDGET = 64;
+		static constexpr u32 MAX_SPIN_BUDGET = 4096;
 
 		// Expected call frequency is NotifyOfWork > WaitForWork > WaitForEmpty
 		// So optimize states for fast NotifyOfWork
@@ -180,6 +185,9 @@ namespace Threading
 		bool CheckForWork();
 		/// Wait for work to be added to the queue
 		void WaitForWork();
+		/// Wait for work to be added to the queue, spinning for a while before sleeping
+		/// The spin length adapts to how often spinning actually caught new work
+		void WaitForWorkWithSpin();
 		/// Wait for the worker thread to finish processing all entries in the queue or die
 		/// Returns false if the thread is dead
 		bool WaitForEmpty();
@@ -54,7 +54,8 @@ class ringbuffer_base
     static const int padding_size = __cachelinesize - sizeof(size_t);
 
     std::atomic<size_t> write_index_;
-    char padding1[padding_size]; /* force read_index and write_index to different cache lines */
+    size_t staged_write_index; /* only accessed by the push thread, see stage() */
+    char padding1[padding_size - sizeof(size_t)]; /* force read_index and write_index to different cache lines */
     std::atomic<size_t> read_index_;
     char padding2[padding_size]; /* force read_index and pending_pop_read_index to different cache lines */
 
@@ -68,7 +69,7 @@ class ringbuffer_base
 
 public:
     ringbuffer_base(void):
-        write_index_(0), read_index_(0), pending_pop_read_index(0)
+        write_index_(0), staged_write_index(0), read_index_(0), pending_pop_read_index(0)
     {
         // Use dynamically allocation here with no T object dependency
         // Otherwise the ringbuffer_base destructor will call the destructor
@@ -95,7 +96,21 @@ public:
 
     bool push(T const & t)
     {
-        const size_t write_index = write_index_.load(std::memory_order_relaxed);  // only written from push thread
+        if (!stage(t))
+            return false;
+
+        publish();
+        return true;
+    }
+
+    /** Copies an element into the ringbuffer without making it visible to the pop thread
+     *
+     * \return true, if the element was staged, false if the ringbuffer is full
+     * \note Staged elements are published together by publish(), with a single release store
+     * */
+    bool stage(T const & t)
+    {
+        const size_t write_index = staged_write_index;
         const size_t next = next_index(write_index);
 
         if (next == read_index_.load(std::memory_order_acquire))
@@ -103,11 +118,26 @@ public:
 
         new (buffer + write_index) T(t); // copy-construct
 
-        write_index_.store(next, std::memory_order_release);
+        staged_write_index = next;
 
         return true;
     }
 
+    /** Makes all staged elements visible to the pop thread */
+    void publish()
+    {
+        write_index_.store(staged_write_index, std::memory_order_release);
+    }
+
+    /** Number of elements staged since the last publish(), only valid from the push thread */
+    size_t staged() const
+    {
+        const size_t write_index = write_index_.load(std::memory_order_relaxed);
+        if (write_index > staged_write_index)
+            return (staged_write_index + max_size) - write_index;
+        return staged_write_index - write_index;
+    }
+
     bool pop (T & ret)
     {
         const size_t write_index = write_index_.load(std::memory_order_acquire);
@@ -161,6 +191,7 @@ public:
      * */
     void reset(void)
     {
+        staged_write_index = 0;
         write_index_.store(0, std::memory_order_relaxed);
         read_index_.store(0, std::memory_order_release);
     }
@@ -27,6 +27,9 @@ namespace x86Emitter
 	const xImplAVX_Move xVMOVUPS = {0x00, 0x10, 0x11};
 
 	const xImplAVX_ThreeArgYMM xVPAND = {0x66, 0xDB};
+	const xImplAVX_ThreeArgYMM xVPANDN = {0x66, 0xDF};
+	const xImplAVX_ThreeArgYMM xVPOR = {0x66, 0xEB};
+	const xImplAVX_ThreeArgYMM xVPXOR = {0x66, 0xEF};
 	const xImplAVX_CmpInt xVPCMP = {
 		{0x66, 0x74}, // VPCMPEQB
 		{0x66, 0x75}, // VPCMPEQW
@@ -36,6 +39,47 @@ namespace x86Emitter
 		{0x66, 0x66}, // VPCMPGTD
 	};
 
+	const xImplAVX_ShiftImm xVPSLLD = {0x72, 6};
+	const xImplAVX_ShiftImm xVPSRLD = {0x72, 2};
+	const xImplAVX_ShiftImm xVPSRAD = {0x72, 4};
+
+	const xImplAVX_ArithFloat xVADD = {
+		{0x00, 0x58}, // VADDPS
+		{0x66, 0x58}, // VADDPD
+		{0xF3, 0x58}, // VADDSS
+		{0xF2, 0x58}, // VADDSD
+	};
+	const xImplAVX_ArithFloat xVSUB = {
+		{0x00, 0x5C}, // VSUBPS
+		{0x66, 0x5C}, // VSUBPD
+		{0xF3, 0x5C}, // VSUBSS
+		{0xF2, 0x5C}, // VSUBSD
+	};
+	const xImplAVX_ArithFloat xVMUL = {
+		{0x00, 0x59}, // VMULPS
+		{0x66, 0x59}, // VMULPD
+		{0xF3, 0x59}, // VMULSS
+		{0xF2, 0x59}, // VMULSD
+	};
+	const xImplAVX_ArithFloat xVDIV = {
+		{0x00, 0x5E}, // VDIVPS
+		{0x66, 0x5E}, // VDIVPD
+		{0xF3, 0x5E}, // VDIVSS
+		{0xF2, 0x5E}, // VDIVSD
+	};
+	const xImplAVX_ArithFloat xVMIN = {
+		{0x00, 0x5D}, // VMINPS
+		{0x66, 0x5D}, // VMINPD
+		{0xF3, 0x5D}, // VMINSS
+		{0xF2, 0x5D}, // VMINSD
+	};
+	const xImplAVX_ArithFloat xVMAX = {
+		{0x00, 0x5F}, // VMAXPS
+		{0x66, 0x5F}, // VMAXPD
+		{0xF3, 0x5F}, // VMAXSS
+		{0xF2, 0x5F}, // VMAXSD
+	};
+
 	void xVMOVMSKPS(const xRegister32& to, const xRegisterSSE& from)
 	{
 		xOpWriteC5(0x00, 0x50, to, xRegister32(), from);
@@ -46,6 +90,18 @@ namespace x86Emitter
 		xOpWriteC5(0x66, 0x50, to, xRegister32(), from);
 	}
 
+	void xVBLENDVPS(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2, const xRegisterSSE& mask)
+	{
+		xOpWriteVEX(0x66, 0x4A3A, false, to, from1, from2);
+		xWrite8(static_cast<u8>(mask.Id << 4));
+	}
+
+	void xImplAVX_ShiftImm::operator()(const xRegisterSSE& to, const xRegisterSSE& from, u8 imm8) const
+	{
+		xOpWriteVEX(0x66, Opcode, false, static_cast<uint>(Modcode), to, from);
+		xWrite8(imm8);
+	}
+
 	void xImplAVX_Move::operator()(const xRegisterSSE& to, const xRegisterSSE& from) const
 	{
 		if (to != from)
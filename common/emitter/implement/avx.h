@@ -43,6 +43,15 @@ namespace x86Emitter
 		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const;
 	};
 
+	// Shift by immediate, the opcode extension goes in ModRM.reg and the destination in VEX.vvvv.
+	struct xImplAVX_ShiftImm
+	{
+		u8 Opcode;
+		u8 Modcode;
+
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from, u8 imm8) const;
+	};
+
 	struct xImplAVX_ArithFloat
 	{
 		xImplAVX_ThreeArgYMM PS;
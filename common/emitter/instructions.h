@@ -405,9 +405,26 @@ namespace x86Emitter
 	extern const xImplAVX_Move xVMOVAPS;
 	extern const xImplAVX_Move xVMOVUPS;
 	extern const xImplAVX_ThreeArgYMM xVPAND;
+	extern const xImplAVX_ThreeArgYMM xVPANDN;
+	extern const xImplAVX_ThreeArgYMM xVPOR;
+	extern const xImplAVX_ThreeArgYMM xVPXOR;
 	extern const xImplAVX_CmpInt xVPCMP;
 
+	extern const xImplAVX_ShiftImm xVPSLLD;
+	extern const xImplAVX_ShiftImm xVPSRLD;
+	extern const xImplAVX_ShiftImm xVPSRAD;
+
+	extern const xImplAVX_ArithFloat xVADD;
+	extern const xImplAVX_ArithFloat xVSUB;
+	extern const xImplAVX_ArithFloat xVMUL;
+	extern const xImplAVX_ArithFloat xVDIV;
+	extern const xImplAVX_ArithFloat xVMIN;
+	extern const xImplAVX_ArithFloat xVMAX;
+
 	extern void xVMOVMSKPS(const xRegister32& to, const xRegisterSSE& from);
 	extern void xVMOVMSKPD(const xRegister32& to, const xRegisterSSE& from);
 
+	// to = (sign bit of mask) ? from2 : from1, per dword.
+	extern void xVBLENDVPS(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2, const xRegisterSSE& mask);
+
 } // namespace x86Emitter
@@ -37,6 +37,10 @@ namespace x86Emitter
 	extern void EmitRex(const xRegisterBase& reg1, const void* src);
 	extern void EmitRex(const xRegisterBase& reg1, const xIndirectVoid& sib);
 
+	// REX.X and REX.B bits for an rm operand (bit 1 = X, bit 0 = B), for VEX prefixes.
+	extern u8 GetRexXB(const xRegisterBase& reg);
+	extern u8 GetRexXB(const xIndirectVoid& sib);
+
 	extern void _xMovRtoR(const xRegisterInt& to, const xRegisterInt& from);
 
 	template <typename T1, typename T2>
@@ -113,32 +117,66 @@ namespace x86Emitter
 		xWrite8(imm8);
 	}
 
-	// VEX 2 Bytes Prefix
+	// VEX Prefix, using the 2 byte form when the opcode map, W and the rm operand allow it.
+	// opcode follows xOpWrite0F: 0x??38 and 0x??3A select the 0F38 and 0F3A maps.
+	// param1 may be an opcode extension instead of a register, then param2 is the destination.
 	template <typename T1, typename T2, typename T3>
-	__emitinline void xOpWriteC5(u8 prefix, u8 opcode, const T1& param1, const T2& param2, const T3& param3)
+	__emitinline void xOpWriteVEX(u8 prefix, u16 opcode, bool w, const T1& param1, const T2& param2, const T3& param3)
 	{
-		const xRegisterBase& reg = param1.IsReg() ? param1 : param2;
-
-		u8 nR = reg.IsExtended() ? 0x00 : 0x80;
+		bool r;
 		u8 L;
 
-		// Needed for 256-bit movemask.
-		if constexpr (std::is_same_v<T3, xRegisterSSE>)
-			L = param3._operandSize == 32 ? 4 : 0;
+		if constexpr (std::is_integral_v<T1>)
+		{
+			r = false;
+			L = param2._operandSize == 32 ? 4 : 0;
+		}
 		else
-			L = reg._operandSize == 32 ? 4 : 0;
+		{
+			const xRegisterBase& reg = param1.IsReg() ? param1 : param2;
+			r = reg.IsExtended();
+
+			// Needed for 256-bit movemask.
+			if constexpr (std::is_same_v<T3, xRegisterSSE>)
+				L = param3._operandSize == 32 ? 4 : 0;
+			else
+				L = reg._operandSize == 32 ? 4 : 0;
+		}
 
-		u8 nv = (param2.IsEmpty() ? 0xF : ((~param2.Id & 0xF))) << 3;
+		const u8 xb = GetRexXB(param3);
+		const u8 nv = (param2.IsEmpty() ? 0xF : ((~param2.Id & 0xF))) << 3;
 
-		u8 p =
+		const u8 p =
 			prefix == 0xF2 ? 3 :
 			prefix == 0xF3 ? 2 :
 			prefix == 0x66 ? 1 :
                              0;
 
-		xWrite8(0xC5);
-		xWrite8(nR | nv | L | p);
-		xWrite8(opcode);
+		const u8 map =
+			(opcode & 0xff) == 0x38 ? 2 :
+			(opcode & 0xff) == 0x3a ? 3 :
+                                      1;
+
+		if (map == 1 && xb == 0 && !w)
+		{
+			xWrite8(0xC5);
+			xWrite8((r ? 0x00 : 0x80) | nv | L | p);
+			xWrite8(static_cast<u8>(opcode));
+		}
+		else
+		{
+			xWrite8(0xC4);
+			xWrite8((r ? 0x00 : 0x80) | ((~xb & 3) << 5) | map);
+			xWrite8((w ? 0x80 : 0x00) | nv | L | p);
+			xWrite8(map == 1 ? static_cast<u8>(opcode) : static_cast<u8>(opcode >> 8));
+		}
 		EmitSibMagic(param1, param3);
 	}
+
+	// VEX Prefix for 0F map opcodes (falls back to 3 bytes for extended rm/index registers)
+	template <typename T1, typename T2, typename T3>
+	__emitinline void xOpWriteC5(u8 prefix, u8 opcode, const T1& param1, const T2& param2, const T3& param3)
+	{
+		xOpWriteVEX(prefix, opcode, false, param1, param2, param3);
+	}
 } // namespace x86Emitter
@@ -406,6 +406,23 @@ const xRegister32
 			xWrite8(rex);
 	}
 
+	u8 GetRexXB(const xRegisterBase& reg)
+	{
+		return reg.IsExtended() ? 1 : 0;
+	}
+
+	u8 GetRexXB(const xIndirectVoid& sib)
+	{
+		bool x = sib.Index.IsExtended();
+		bool b = sib.Base.IsExtended();
+		if (!NeedsSibMagic(sib))
+		{
+			b = x;
+			x = false;
+		}
+		return (x << 1) | (u8)b;
+	}
+
 	// For use by instructions that are implicitly wide
 	void EmitRexImplicitlyWide(const xRegisterBase& reg)
 	{
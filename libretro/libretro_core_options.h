@@ -119,6 +119,132 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "pcsx2_tiered_compilation",
+      "System > Tiered Recompilation (Restart)",
+      "Tiered Recompilation (Restart)",
+      "Interprets EE and IOP code for its first few executions before recompiling it, so code which only runs a few times is never compiled. Code which keeps running is still compiled on the emulation thread when it gets hot, so this doesn't remove compile stutter.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_ee_loop_register_carry",
+      "System > EE Loop Register Carry (Restart)",
+      "EE Loop Register Carry (Restart)",
+      "Keeps the registers a tight EE loop reads in host registers from one iteration to the next, instead of reloading them from memory every time around.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_ee_loop_idioms",
+      "System > EE Bulk Copy/Fill Loops (Restart)",
+      "EE Bulk Copy/Fill Loops (Restart)",
+      "Runs EE loops which copy or clear RAM one element at a time as a single host memcpy/memset, up to the next scheduled event. Loops touching hardware registers still run normally.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_vu_tiered_compilation",
+      "System > Tiered VU Recompilation (Restart)",
+      "Tiered VU Recompilation (Restart)",
+      "Compiles new VU microprogram blocks quickly without cross-block flag analysis, and recompiles them with full optimizations once they have run a few dozen times. Reduces stutter in games which upload new microprograms often.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_vu_avx",
+      "System > VU AVX Code Generation (Restart)",
+      "VU AVX Code Generation (Restart)",
+      "Compiles VU arithmetic with non-destructive three-operand AVX instructions when the CPU supports AVX2, which avoids register copies. Has no effect on CPUs without AVX2.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_block_profiler",
+      "System > Profile Recompiled Blocks (Restart)",
+      "Profile Recompiled Blocks (Restart)",
+      "Developer option. Counts entries to every recompiled EE, IOP and VU block, and writes a report of the hottest guest code to the cache folder when the game is closed. On Linux, also writes /tmp/perf-<pid>.map so perf can name recompiled code. Slows down emulation.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_huge_pages",
+      "System > Huge Pages (Restart)",
+      "Huge Pages (Restart)",
+      "Asks the host OS to back emulated RAM, GS memory and recompiled code with huge pages, reducing TLB misses. Only supported on Linux with transparent huge pages enabled.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_cdvd_preload",
+      "System > Preload Compressed Discs to RAM (Restart)",
+      "Preload Compressed Discs to RAM (Restart)",
+      "Decompresses CHD, CSO and indexed gzip images into RAM in the background after boot, removing decompression stalls from disc reads. Skipped if the image is larger than half of the host's memory.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_cdvd_trace",
+      "System > Record Disc Read Trace (Restart)",
+      "Record Disc Read Trace (Restart)",
+      "Developer option. Logs every disc sector request to a .trace file in the cache folder, for replaying with tools/cdvd_trace_replay.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "pcsx2_enable_cheats",
       "System > Enable Cheats",
@@ -10,6 +10,7 @@
 #include <type_traits>
 #include <thread>
 #include <atomic>
+#include <mutex>
 
 #include "libretro_core_options.h"
 #include "GS.h"
@@ -355,6 +356,69 @@ static void check_variables(bool first_run)
 			bool fast_cdvd = !strcmp(var.value, "enabled");
 			s_settings_interface.SetBoolValue("EmuCore/Speedhacks", "fastCDVD", fast_cdvd);
 		}
+
+		var.key = "pcsx2_tiered_compilation";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool tiered_compilation = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "EnableTieredCompilation", tiered_compilation);
+		}
+
+		var.key = "pcsx2_ee_loop_register_carry";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool ee_loop_register_carry = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "EnableEELoopRegisterCarry", ee_loop_register_carry);
+		}
+
+		var.key = "pcsx2_ee_loop_idioms";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool ee_loop_idioms = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "EnableEELoopIdioms", ee_loop_idioms);
+		}
+
+		var.key = "pcsx2_vu_tiered_compilation";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool vu_tiered_compilation = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "EnableVUTieredCompilation", vu_tiered_compilation);
+		}
+
+		var.key = "pcsx2_vu_avx";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool vu_avx = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "EnableVUAVX", vu_avx);
+		}
+
+		var.key = "pcsx2_block_profiler";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool block_profiler = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "EnableBlockProfiler", block_profiler);
+		}
+
+		var.key = "pcsx2_huge_pages";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool huge_pages = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore", "EnableHugePages", huge_pages);
+		}
+
+		var.key = "pcsx2_cdvd_preload";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool cdvd_preload = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore", "CdvdPreload", cdvd_preload);
+		}
+
+		var.key = "pcsx2_cdvd_trace";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool cdvd_trace = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore", "CdvdTrace", cdvd_trace);
+		}
 	}
 
 	if (setting_plugin_type == PLUGIN_PGS)
@@ -1229,7 +1293,7 @@ void retro_get_system_info(retro_system_info* info)
 {
 	info->library_version  = "1";
 	info->library_name     = "LRPS2";
-	info->valid_extensions = "elf|iso|ciso|cue|bin|gz|chd|cso|zso";
+	info->valid_extensions = "elf|iso|ciso|cue|bin|gz|chd|cso|zso|zst";
 	info->need_fullpath    = true;
 	info->block_extract    = true;
 }
@@ -1679,6 +1743,31 @@ void retro_unload_game(void)
 	retro_set_region(RETRO_REGION_NTSC); /* set back to default */
 }
 
+static std::mutex s_osd_messages_mutex;
+static std::vector<std::pair<std::string, float>> s_osd_messages;
+
+void Host::AddOSDMessage(std::string message, float duration)
+{
+	std::unique_lock lock(s_osd_messages_mutex);
+	s_osd_messages.emplace_back(std::move(message), duration);
+}
+
+static void FlushOSDMessages()
+{
+	std::vector<std::pair<std::string, float>> messages;
+	{
+		std::unique_lock lock(s_osd_messages_mutex);
+		if (s_osd_messages.empty())
+			return;
+		messages.swap(s_osd_messages);
+	}
+
+	// Only the most recent message is visible anyway.
+	const auto& [text, duration] = messages.back();
+	retro_message msg = {text.c_str(), static_cast<unsigned>(duration * 60.0f)};
+	environ_cb(RETRO_ENVIRONMENT_SET_MESSAGE, &msg);
+}
+
 void retro_run(void)
 {
 	bool updated = false;
@@ -1686,6 +1775,7 @@ void retro_run(void)
 		check_variables(false);
 
 	Input::Update();
+	FlushOSDMessages();
 
 	if (!MTGS::IsOpen())
 		MTGS::TryOpenGS();
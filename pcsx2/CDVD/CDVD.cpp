@@ -1147,6 +1147,9 @@ static uint cdvdStartSeek(uint newsector, CDVD_MODE_TYPE mode, bool transition_t
 {
 	cdvd.SeekToSector = newsector;
 
+	// Let the image reader start fetching while we emulate the seek delay.
+	DoCDVDprefetch(newsector, static_cast<u32>(std::max(cdvd.SectorCnt, 1)));
+
 	uint delta = abs(static_cast<s32>(cdvd.SeekToSector - cdvd.CurrentSector));
 	uint seektime = 0;
 	bool isSeeking = false;
@@ -17,9 +17,13 @@
 #include <time.h>
 #include <exception>
 #include <memory>
+#include <cstdio>
 #include <cstring>
 
 #include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/StringUtil.h"
 
 #include "IsoFS/IsoFS.h"
 #include "IsoFS/IsoFSCDVD.h"
@@ -27,6 +31,8 @@
 
 #include "DebugTools/SymbolMap.h"
 #include "Config.h"
+#include "Common.h"
+#include "R3000A.h"
 
 CDVD_API* CDVD = NULL;
 
@@ -57,6 +63,7 @@ static s32 CALLBACK NODISCdummyS32(void) { return 0; }
 static void CALLBACK NODISCnewDiskCB(void (*)(void)) { }
 static s32 CALLBACK NODISCreadSector(u8* tempbuffer, u32 lsn, int mode) { return -1; }
 static s32 CALLBACK NODISCgetDualInfo(s32* dualType, u32* _layer1start) { return -1; }
+static void CALLBACK NODISCprefetch(u32 lsn, u32 count) { }
 
 static CDVD_API CDVDapi_NoDisc =
 {
@@ -77,6 +84,7 @@ static CDVD_API CDVDapi_NoDisc =
 
 	NODISCreadSector,
 	NODISCgetDualInfo,
+	NODISCprefetch,
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +312,76 @@ void CDVDsys_ChangeSource(CDVD_SourceType type)
 	}
 }
 
+// ----------------------------------------------------------------------------
+// Read trace
+// When enabled, every request passing through the DoCDVD* wrappers is logged as
+// one text line, for replaying real access patterns with tools/cdvd_trace_replay:
+//   <type>,<iop cycle>,<lsn>,<count>,<mode>
+// where type is R (readTrack), S (readSector) or P (prefetch hint from a seek).
+//
+static RFILE* s_trace_file = nullptr;
+static std::string s_trace_buffer;
+static u64 s_trace_cycles = 0;
+static u32 s_trace_last_cycle = 0;
+
+static constexpr size_t TRACE_FLUSH_SIZE = 64 * 1024;
+
+static void CDVDtrace_Flush()
+{
+	if (s_trace_buffer.empty())
+		return;
+
+	if (rfwrite(s_trace_buffer.data(), s_trace_buffer.size(), 1, s_trace_file) != 1)
+		Console.Error("CDVD: Failed to write read trace.");
+	s_trace_buffer.clear();
+}
+
+static void CDVDtrace_Open(const std::string& source)
+{
+	if (!EmuConfig.CdvdTrace || EmuFolders::Cache.empty())
+		return;
+
+	const std::string title(Path::GetFileName(source.empty() ? std::string_view("nodisc") : std::string_view(source)));
+	const std::string path(Path::Combine(EmuFolders::Cache,
+		StringUtil::StdStringFromFormat("cdvd_%s_%lld.trace", title.c_str(), static_cast<long long>(time(nullptr)))));
+	s_trace_file = FileSystem::OpenFile(path.c_str(), "wb");
+	if (!s_trace_file)
+	{
+		Console.Error("CDVD: Unable to create read trace '%s'.", path.c_str());
+		return;
+	}
+
+	// psxRegs.cycle wraps every couple of minutes, so timestamps are accumulated from deltas.
+	s_trace_cycles = 0;
+	s_trace_last_cycle = psxRegs.cycle;
+	s_trace_buffer = StringUtil::StdStringFromFormat("# pcsx2 cdvd trace v1 clock=%lld image=%s\n", static_cast<long long>(PSXCLK), source.c_str());
+	Console.WriteLn("CDVD: Recording read trace to '%s'.", path.c_str());
+}
+
+static void CDVDtrace_Close()
+{
+	if (!s_trace_file)
+		return;
+
+	CDVDtrace_Flush();
+	rfclose(s_trace_file);
+	s_trace_file = nullptr;
+	s_trace_buffer = {};
+}
+
+static void CDVDtrace_Record(char type, u32 lsn, u32 count, int mode)
+{
+	s_trace_cycles += psxRegs.cycle - s_trace_last_cycle;
+	s_trace_last_cycle = psxRegs.cycle;
+
+	char line[64];
+	const int len = std::snprintf(line, sizeof(line), "%c,%llu,%u,%u,%d\n", type,
+		static_cast<unsigned long long>(s_trace_cycles), lsn, count, mode);
+	s_trace_buffer.append(line, len);
+	if (s_trace_buffer.size() >= TRACE_FLUSH_SIZE)
+		CDVDtrace_Flush();
+}
+
 bool DoCDVDopen(void)
 {
 	CDVD->newDiskCB(cdvdNewDiskCB);
@@ -313,6 +391,7 @@ bool DoCDVDopen(void)
 	if (ret == -1)
 		return false; // error! (handled by caller)
 
+	CDVDtrace_Open(m_SourceFilename[CurrentSourceType]);
 	DoCDVDdetectDiskType();
 	return true;
 }
@@ -322,16 +401,21 @@ void DoCDVDclose(void)
 	if (CDVD->close)
 		CDVD->close();
 
+	CDVDtrace_Close();
 	DoCDVDresetDiskTypeCache();
 }
 
 s32 DoCDVDreadSector(u8* buffer, u32 lsn, int mode)
 {
+	if (s_trace_file)
+		CDVDtrace_Record('S', lsn, 1, mode);
 	return CDVD->readSector(buffer, lsn, mode);
 }
 
 s32 DoCDVDreadTrack(u32 lsn, int mode)
 {
+	if (s_trace_file)
+		CDVDtrace_Record('R', lsn, 1, mode);
 	return CDVD->readTrack(lsn, mode);
 }
 
@@ -340,6 +424,13 @@ s32 DoCDVDgetBuffer(u8* buffer)
 	return CDVD->getBuffer(buffer);
 }
 
+void DoCDVDprefetch(u32 lsn, u32 count)
+{
+	if (s_trace_file)
+		CDVDtrace_Record('P', lsn, count, 0);
+	CDVD->prefetch(lsn, count);
+}
+
 s32 DoCDVDdetectDiskType(void)
 {
 	if (diskTypeCached < 0)
@@ -124,6 +124,9 @@ typedef s32(CALLBACK* _CDVDgetDualInfo)(s32* dualType, u32* _layer1start);
 
 typedef void(CALLBACK* _CDVDnewDiskCB)(void (*callback)());
 
+// Hints that the given sectors will be read soon (e.g. when seeking)
+typedef void(CALLBACK* _CDVDprefetch)(u32 lsn, u32 count);
+
 enum class CDVD_SourceType : uint8_t
 {
 	Iso,    // use built in ISO api
@@ -153,6 +156,7 @@ struct CDVD_API
 	// special functions, not in external interface yet
 	_CDVDreadSector readSector;
 	_CDVDgetDualInfo getDualInfo;
+	_CDVDprefetch prefetch;
 };
 
 // ----------------------------------------------------------------------------
@@ -174,5 +178,6 @@ extern void DoCDVDclose(void);
 extern s32 DoCDVDreadSector(u8* buffer, u32 lsn, int mode);
 extern s32 DoCDVDreadTrack(u32 lsn, int mode);
 extern s32 DoCDVDgetBuffer(u8* buffer);
+extern void DoCDVDprefetch(u32 lsn, u32 count);
 extern s32 DoCDVDdetectDiskType(void);
 extern void DoCDVDresetDiskTypeCache(void);
@@ -27,6 +27,7 @@
 
 #include "IsoFileFormats.h"
 #include "CDVD.h"
+#include "Config.h"
 
 static InputIsoFile iso;
 
@@ -50,7 +51,7 @@ static s32 CALLBACK ISOopen(const char* pTitle)
 		return -1;
 	}
 
-	if (!iso.Open(pTitle))
+	if (!iso.Open(pTitle, EmuConfig.CdvdPreload))
 		return -1;
 
 	switch (iso.GetType())
@@ -381,6 +382,11 @@ static s32 CALLBACK ISOgetBuffer(u8* buffer)
 	return iso.FinishRead3(buffer, pmode);
 }
 
+static void CALLBACK ISOprefetch(u32 lsn, u32 count)
+{
+	iso.Prefetch(lsn, count);
+}
+
 static s32 CALLBACK ISOgetTrayStatus(void)
 {
 	return CDVD_TRAY_CLOSE;
@@ -410,4 +416,5 @@ CDVD_API CDVDapi_Iso =
 
 	ISOreadSector,
 	ISOgetDualInfo,
+	ISOprefetch,
 };
@@ -203,6 +203,14 @@ int ChdFileReader::ReadChunk(void* dst, s64 chunkID)
 	return hunk_size;
 }
 
+std::unique_ptr<ThreadedFileReader> ChdFileReader::OpenPreloadReader()
+{
+	auto reader = std::make_unique<ChdFileReader>();
+	if (!reader->Open2(m_filename))
+		return {};
+	return reader;
+}
+
 void ChdFileReader::Close2()
 {
 	if (ChdFile)
@@ -36,6 +36,8 @@ public:
 	int ReadChunk(void* dst, s64 blockID) override;
 
 	void Close2(void) override;
+
+	std::unique_ptr<ThreadedFileReader> OpenPreloadReader() override;
 	uint GetBlockCount(void) const override;
 
 private:
@@ -176,6 +176,14 @@ bool CsoFileReader::InitializeBuffers()
 	return true;
 }
 
+std::unique_ptr<ThreadedFileReader> CsoFileReader::OpenPreloadReader()
+{
+	auto reader = std::make_unique<CsoFileReader>();
+	if (!reader->Open2(m_filename))
+		return {};
+	return reader;
+}
+
 void CsoFileReader::Close2()
 {
 	m_filename.clear();
@@ -41,6 +41,8 @@ public:
 
 	void Close2(void) override;
 
+	std::unique_ptr<ThreadedFileReader> OpenPreloadReader() override;
+
 	uint GetBlockCount(void) const override
 	{
 		return (m_totalSize - m_dataoffset) / m_blocksize;
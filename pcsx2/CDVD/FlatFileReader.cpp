@@ -3,13 +3,25 @@
 
 #include "FlatFileReader.h"
 
+#include "common/Console.h"
 #include "common/FileSystem.h"
+#ifdef _WIN32
+#include "common/RedtapeWindows.h"
+#include "common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include <algorithm> /* std::min */
 #include <cstring>
 
 static constexpr size_t CHUNK_SIZE = 128 * 1024;
 
+/// Minimum amount to ask the OS to read ahead when the drive seeks
+static constexpr size_t PREFETCH_SIZE = 1024 * 1024;
+
 FlatFileReader::FlatFileReader() = default;
 
 FlatFileReader::~FlatFileReader()
@@ -31,9 +43,71 @@ bool FlatFileReader::Open2(std::string filename)
 	}
 
 	m_file_size = static_cast<u64>(filesize);
+
+	// Not fatal, we just go through the read thread instead.
+	if (!MapFile())
+		Console.Warning("CDVD: Failed to map '%s', using buffered reads.", m_filename.c_str());
+
+	return true;
+}
+
+bool FlatFileReader::MapFile()
+{
+	if (m_file_size > static_cast<u64>(SIZE_MAX))
+		return false;
+
+	const size_t size = static_cast<size_t>(m_file_size);
+#ifdef _WIN32
+	const HANDLE file = CreateFileW(StringUtil::UTF8StringToWideString(m_filename).c_str(), GENERIC_READ,
+		FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	// The mapping keeps its own reference to the file.
+	const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		return false;
+
+	void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+	if (!ptr)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	m_mapping_handle = mapping;
+#else
+	const int fd = open(m_filename.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	// The mapping stays valid after the descriptor is closed.
+	void* ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED)
+		return false;
+#endif
+
+	m_mapping = static_cast<u8*>(ptr);
 	return true;
 }
 
+void FlatFileReader::UnmapFile()
+{
+	if (!m_mapping)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_mapping);
+	CloseHandle(m_mapping_handle);
+	m_mapping_handle = nullptr;
+#else
+	munmap(m_mapping, static_cast<size_t>(m_file_size));
+#endif
+	m_mapping = nullptr;
+}
+
 ThreadedFileReader::Chunk FlatFileReader::ChunkForOffset(u64 offset)
 {
 	ThreadedFileReader::Chunk chunk = {};
@@ -60,11 +134,19 @@ int FlatFileReader::ReadChunk(void* dst, s64 blockID)
 
 	const u32 read_size = static_cast<u32>(std::min<u64>(m_file_size - file_offset, CHUNK_SIZE));
 
+	if (m_mapping)
+	{
+		std::memcpy(dst, m_mapping + file_offset, read_size);
+		return static_cast<int>(read_size);
+	}
+
 	return (rfread(dst, read_size, 1, m_file) == 1) ? static_cast<int>(read_size) : 0;
 }
 
 void FlatFileReader::Close2()
 {
+	UnmapFile();
+
 	if (!m_file)
 		return;
 
@@ -77,3 +159,36 @@ u32 FlatFileReader::GetBlockCount() const
 {
 	return static_cast<u32>(m_file_size / m_blocksize);
 }
+
+const u8* FlatFileReader::GetMappedSector(u32 sector) const
+{
+	if (!m_mapping)
+		return nullptr;
+
+	const u64 offset = static_cast<u64>(sector) * m_blocksize + m_dataoffset;
+	if (offset + m_blocksize > m_file_size)
+		return nullptr;
+
+	return m_mapping + offset;
+}
+
+void FlatFileReader::Prefetch(u32 sector, u32 count)
+{
+	if (!m_mapping)
+		return;
+
+	const u64 offset = static_cast<u64>(sector) * m_blocksize + m_dataoffset;
+	if (offset >= m_file_size)
+		return;
+
+	// Fault the pages in on the kernel's time rather than in the middle of a DMA.
+	const u64 page_start = offset & ~static_cast<u64>(__pagemask);
+	const u64 length = std::min<u64>(std::max<u64>(static_cast<u64>(count) * m_blocksize, PREFETCH_SIZE) + (offset - page_start),
+		m_file_size - page_start);
+#ifdef _WIN32
+	WIN32_MEMORY_RANGE_ENTRY range = {m_mapping + page_start, static_cast<SIZE_T>(length)};
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+	madvise(m_mapping + page_start, static_cast<size_t>(length), MADV_WILLNEED);
+#endif
+}
@@ -16,6 +16,15 @@ class FlatFileReader final : public ThreadedFileReader
 	RFILE* m_file = nullptr;
 	u64 m_file_size = 0;
 
+	/// Read-only view of the whole file, if the host allowed us to map it
+	u8* m_mapping = nullptr;
+#ifdef _WIN32
+	void* m_mapping_handle = nullptr;
+#endif
+
+	bool MapFile();
+	void UnmapFile();
+
 public:
 	FlatFileReader();
 	~FlatFileReader() override;
@@ -28,4 +37,7 @@ public:
 	void Close2() override;
 
 	u32 GetBlockCount() const override;
+
+	const u8* GetMappedSector(u32 sector) const override;
+	void Prefetch(u32 sector, u32 count) override;
 };
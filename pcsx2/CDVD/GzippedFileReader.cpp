@@ -18,6 +18,9 @@
 #include "common/Path.h"
 #include "common/StringUtil.h"
 
+#include <cstring>
+#include <memory>
+
 #include "GzippedFileReader.h"
 #include "zlib_indexed.h"
 #include "../Config.h"
@@ -26,13 +29,15 @@
 #define CLAMP(val, minval, maxval) (std::min(maxval, std::max(minval, val)))
 
 #define GZIP_ID "PCSX2.index.gzip.v1|"
+#define GZIP_PARTIAL_ID "PCSX2.index.gzip.p1|"
 #define GZIP_ID_LEN (sizeof(GZIP_ID) - 1) /* sizeof includes the \0 terminator */
+static_assert(sizeof(GZIP_PARTIAL_ID) == sizeof(GZIP_ID), "Index IDs must have the same length");
 
 // File format is:
-// - [GZIP_ID_LEN] GZIP_ID (no \0)
+// - [GZIP_ID_LEN] GZIP_ID (no \0), or GZIP_PARTIAL_ID for an index which is still being built
 // - [sizeof(Access)] index (should be allocated, contains various sizes)
 // - [rest] the indexed data points (should be allocated, index->list should then point to it)
-static Access* ReadIndexFromFile(const char* filename)
+static Access* ReadIndexFromFile(const char* filename, bool* partial)
 {
 	s64 size;
 	RFILE *fp = FileSystem::OpenFile(filename, "rb");
@@ -46,7 +51,14 @@ static Access* ReadIndexFromFile(const char* filename)
 	}
 
 	char fileId[GZIP_ID_LEN + 1] = {0};
-	if (rfread(fileId, GZIP_ID_LEN, 1, fp) != 1 || std::memcmp(fileId, GZIP_ID, 4) != 0)
+	if (rfread(fileId, GZIP_ID_LEN, 1, fp) != 1)
+	{
+		filestream_close(fp);
+		return nullptr;
+	}
+
+	*partial = (std::memcmp(fileId, GZIP_PARTIAL_ID, GZIP_ID_LEN) == 0);
+	if (!*partial && std::memcmp(fileId, GZIP_ID, GZIP_ID_LEN) != 0)
 	{
 		filestream_close(fp);
 		return nullptr;
@@ -72,27 +84,77 @@ static Access* ReadIndexFromFile(const char* filename)
 	}
 
 	index->list = reinterpret_cast<Point*>(buffer); // adjust list pointer
+	index->size = index->have;
 	filestream_close(fp);
 	return index;
 }
 
-static void WriteIndexToFile(Access* index, const char* filename)
+static void WriteIndexToFile(const Access* index, const char* filename, bool partial)
 {
 	RFILE *fp = FileSystem::OpenFile(filename, "wb");
 	if (!fp)
 		return;
 
-	bool success = (rfwrite(GZIP_ID, GZIP_ID_LEN, 1, fp) == 1);
+	bool success = (rfwrite(partial ? GZIP_PARTIAL_ID : GZIP_ID, GZIP_ID_LEN, 1, fp) == 1);
 
-	Point* tmp = index->list;
-	index->list = 0; // current pointer is useless on disk, normalize it as 0.
-	rfwrite((char*)index, sizeof(Access), 1, fp);
-	index->list = tmp;
+	// The list may be read concurrently while building in the background, so don't touch the original.
+	Access header = *index;
+	header.list = 0; // current pointer is useless on disk, normalize it as 0.
+	rfwrite((char*)&header, sizeof(Access), 1, fp);
 
 	success = success && (rfwrite((char*)index->list, sizeof(Point) * index->have, 1, fp) == 1);
 	filestream_close(fp);
 }
 
+// The gzip trailer only has the uncompressed size modulo 4GB, which is ambiguous for DVD images.
+// Cross-check it against the volume size in the ISO9660 primary volume descriptor, so playback can
+// start before the whole file has been scanned. Returns -1 if the size can't be determined.
+static s64 ProbeUncompressedSize(RFILE* fp)
+{
+	static constexpr u32 PVD_OFFSET = 16 * 2048;
+	static constexpr u32 PVD_VOLUME_SPACE_SIZE = 80;
+
+	const s64 size = FileSystem::FSize64(fp);
+	u8 isize_bytes[4];
+	if (size < 18 || FileSystem::FSeek64(fp, size - 4, SEEK_SET) == -1 || rfread(isize_bytes, sizeof(isize_bytes), 1, fp) != 1)
+		return -1;
+	const u32 isize = isize_bytes[0] | (isize_bytes[1] << 8) | (isize_bytes[2] << 16) | (static_cast<u32>(isize_bytes[3]) << 24);
+
+	z_stream strm = {};
+	if (inflateInit2(&strm, 47) != Z_OK)
+		return -1;
+
+	std::unique_ptr<u8[]> input = std::make_unique<u8[]>(CHUNK);
+	std::unique_ptr<u8[]> output = std::make_unique<u8[]>(PVD_OFFSET + 2048);
+	strm.next_out = output.get();
+	strm.avail_out = PVD_OFFSET + 2048;
+
+	FileSystem::FSeek64(fp, 0, SEEK_SET);
+	int ret = Z_OK;
+	while (strm.avail_out != 0 && ret == Z_OK)
+	{
+		strm.avail_in = rfread(input.get(), 1, CHUNK, fp);
+		if (strm.avail_in == 0)
+			break;
+		strm.next_in = input.get();
+		ret = inflate(&strm, Z_NO_FLUSH);
+	}
+	const bool have_pvd = (strm.avail_out == 0);
+	inflateEnd(&strm);
+
+	const u8* pvd = output.get() + PVD_OFFSET;
+	if (!have_pvd || pvd[0] != 1 || std::memcmp(pvd + 1, "CD001", 5) != 0)
+		return -1;
+
+	const u32 blocks = pvd[PVD_VOLUME_SPACE_SIZE] | (pvd[PVD_VOLUME_SPACE_SIZE + 1] << 8) |
+		(pvd[PVD_VOLUME_SPACE_SIZE + 2] << 16) | (static_cast<u32>(pvd[PVD_VOLUME_SPACE_SIZE + 3]) << 24);
+	const s64 uncompressed_size = static_cast<s64>(blocks) * 2048;
+	if (static_cast<u32>(uncompressed_size) != isize)
+		return -1;
+
+	return uncompressed_size;
+}
+
 static const char* INDEX_TEMPLATE_KEY = "$(f)";
 
 // template:
@@ -147,10 +209,26 @@ bool GzippedFileReader::LoadOrCreateIndex()
 	if (indexfile.empty())
 		return false;
 
-	if ((m_index = ReadIndexFromFile(indexfile.c_str())) != nullptr)
+	bool partial = false;
+	if (Access* index = ReadIndexFromFile(indexfile.c_str(), &partial))
+	{
+		if (!partial)
+		{
+			m_index = index;
+			return true;
+		}
+
+		if (StartBackgroundIndex(indexfile, index))
+			return true;
+
+		free_index(index);
+	}
+	else if (StartBackgroundIndex(indexfile, nullptr))
+	{
 		return true;
+	}
 
-	// No valid index file. Generate an index
+	// No valid index file, and we can't tell the size without one. Generate an index
 	Console.Warning("This may take a while (but only once). Scanning compressed file to generate a quick access index...");
 
 	const s64 prevoffset = FileSystem::FTell64(m_src);
@@ -162,7 +240,7 @@ bool GzippedFileReader::LoadOrCreateIndex()
 	if (len >= 0)
 	{
 		m_index = index;
-		WriteIndexToFile(m_index, indexfile.c_str());
+		WriteIndexToFile(m_index, indexfile.c_str(), false);
 	}
 	else
 	{
@@ -173,6 +251,166 @@ bool GzippedFileReader::LoadOrCreateIndex()
 	return true;
 }
 
+bool GzippedFileReader::StartBackgroundIndex(const std::string& indexfile, Access* partial)
+{
+	const s64 uncompressed_size = partial ? partial->uncompressed_size : ProbeUncompressedSize(m_src);
+	FileSystem::FSeek64(m_src, 0, SEEK_SET);
+	if (uncompressed_size <= 0 || (partial && partial->have == 0))
+		return false;
+
+	// The scan gets its own handle, since m_src is used for reads in the meantime.
+	if (!(m_index_src = FileSystem::OpenFile(m_filename.c_str(), "rb")))
+		return false;
+
+	if (partial)
+	{
+		m_index = partial;
+	}
+	else
+	{
+		m_index = static_cast<Access*>(std::calloc(1, sizeof(Access)));
+		m_index->span = GZFILE_SPAN_DEFAULT;
+	}
+	m_index->uncompressed_size = uncompressed_size;
+	m_index_filename = indexfile;
+	m_index_checkpoint_have = m_index->have;
+	m_index_complete.store(false, std::memory_order_relaxed);
+	m_index_cancel.store(false, std::memory_order_relaxed);
+
+	if (!partial)
+	{
+		// Reads need at least one access point to start from, so find the first one up front.
+		const add_point_fn add_first_point = [](void* ctx, int bits, s64 in, s64 out, unsigned left, unsigned char* window) {
+			static_cast<GzippedFileReader*>(ctx)->m_index_cancel.store(true, std::memory_order_relaxed);
+			return AddBackgroundIndexPoint(ctx, bits, in, out, left, window);
+		};
+
+		s64 total_out = 0;
+		const int ret = build_index_incremental(m_index_src, m_index->span, nullptr, add_first_point, this, &m_index_cancel, &total_out);
+		m_index_cancel.store(false, std::memory_order_relaxed);
+		if ((ret != Z_OK && ret != Z_STREAM_END) || m_index->have == 0)
+		{
+			filestream_close(m_index_src);
+			m_index_src = nullptr;
+			free_index(m_index);
+			m_index = nullptr;
+			m_index_complete.store(true, std::memory_order_relaxed);
+			return false;
+		}
+
+		if (ret == Z_STREAM_END)
+		{
+			// Small enough that the whole thing was scanned already.
+			filestream_close(m_index_src);
+			m_index_src = nullptr;
+			m_index->uncompressed_size = total_out;
+			WriteIndexToFile(m_index, indexfile.c_str(), false);
+			m_index_complete.store(true, std::memory_order_relaxed);
+			return true;
+		}
+
+		Console.WriteLn("Building gzip index in the background...");
+	}
+	else
+	{
+		Console.WriteLn("Resuming gzip index from %d access points in the background...", m_index->have);
+	}
+
+	m_index_thread = std::thread(&GzippedFileReader::BackgroundIndexThread, this);
+	return true;
+}
+
+void GzippedFileReader::StopBackgroundIndex()
+{
+	if (m_index_thread.joinable())
+	{
+		m_index_cancel.store(true, std::memory_order_relaxed);
+		m_index_thread.join();
+	}
+
+	if (m_index_src)
+	{
+		filestream_close(m_index_src);
+		m_index_src = nullptr;
+	}
+
+	m_index_complete.store(true, std::memory_order_relaxed);
+}
+
+void GzippedFileReader::BackgroundIndexThread()
+{
+	// This thread is the only one modifying the index, so it can read it without the lock.
+	Point* resume = &m_index->list[m_index->have - 1];
+
+	s64 total_out = 0;
+	const int ret = build_index_incremental(m_index_src, m_index->span, resume, &GzippedFileReader::AddBackgroundIndexPoint,
+		this, &m_index_cancel, &total_out);
+	if (ret == Z_STREAM_END)
+	{
+		if (total_out != m_index->uncompressed_size)
+		{
+			Console.Warning("Gzip index: stream holds %lld bytes, but %lld were expected.",
+				static_cast<long long>(total_out), static_cast<long long>(m_index->uncompressed_size));
+		}
+
+		{
+			std::unique_lock lock(m_index_mutex);
+			if (Point* list = static_cast<Point*>(std::realloc(m_index->list, sizeof(Point) * m_index->have)))
+				m_index->list = list;
+			m_index->size = m_index->have;
+		}
+
+		WriteIndexToFile(m_index, m_index_filename.c_str(), false);
+		m_index_complete.store(true, std::memory_order_release);
+		Console.WriteLn("Finished building gzip index (%d access points).", m_index->have);
+
+		// Preload readers need the finished index, so a preload requested on open starts now.
+		RetryPreload();
+	}
+	else if (ret == Z_OK)
+	{
+		// Cancelled, save what we have so the next open can pick up from here.
+		WriteIndexToFile(m_index, m_index_filename.c_str(), true);
+	}
+	else
+	{
+		Console.Error("Failed to build gzip index (%d), reads past %lld will be slow.", ret,
+			static_cast<long long>(m_index->list[m_index->have - 1].out));
+	}
+}
+
+int GzippedFileReader::AddBackgroundIndexPoint(void* ctx, int bits, s64 in, s64 out, unsigned left, unsigned char* window)
+{
+	GzippedFileReader* const reader = static_cast<GzippedFileReader*>(ctx);
+	Access* const index = reader->m_index;
+
+	{
+		std::unique_lock lock(reader->m_index_mutex);
+
+		// Grow the list ourselves, since addpoint() frees the whole index if it runs out of memory.
+		if (index->have == index->size)
+		{
+			const int new_size = index->size ? (index->size * 2) : 8;
+			Point* list = static_cast<Point*>(std::realloc(index->list, sizeof(Point) * new_size));
+			if (!list)
+				return 0;
+
+			index->list = list;
+			index->size = new_size;
+		}
+
+		addpoint(index, bits, in, out, left, window);
+	}
+
+	if (index->have - reader->m_index_checkpoint_have >= GZFILE_CHECKPOINT_POINTS)
+	{
+		WriteIndexToFile(index, reader->m_index_filename.c_str(), true);
+		reader->m_index_checkpoint_have = index->have;
+	}
+
+	return 1;
+}
+
 bool GzippedFileReader::Open2(std::string filename)
 {
 	Close();
@@ -187,8 +425,21 @@ bool GzippedFileReader::Open2(std::string filename)
 	return true;
 }
 
+std::unique_ptr<ThreadedFileReader> GzippedFileReader::OpenPreloadReader()
+{
+	if (!m_index_complete.load(std::memory_order_acquire))
+		return {};
+
+	auto reader = std::make_unique<GzippedFileReader>();
+	if (!reader->Open2(m_filename))
+		return {};
+	return reader;
+}
+
 void GzippedFileReader::Close2()
 {
+	StopBackgroundIndex();
+
 	if (m_z_state.isValid)
 	{
 		inflateEnd(&m_z_state.strm);
@@ -230,7 +481,27 @@ int GzippedFileReader::ReadChunk(void* dst, s64 chunkID)
 
 	const s64 file_offset = chunkID * m_index->span;
 	const u32 read_len = static_cast<u32>(std::min<s64>(m_index->uncompressed_size - file_offset, m_index->span));
-	return extract(m_src, m_index, file_offset, static_cast<unsigned char*>(dst), read_len, &m_z_state);
+	if (m_index_complete.load(std::memory_order_acquire))
+		return extract(m_src, m_index, file_offset, static_cast<unsigned char*>(dst), read_len, &m_z_state);
+
+	// Still scanning. Decode from the closest access point found so far. If that's behind the
+	// requested offset by more than a span, this streams through the part that hasn't been indexed.
+	if (!m_z_state.isValid || m_z_state.out_offset != file_offset)
+	{
+		std::unique_lock lock(m_index_mutex);
+		const Point* here = m_index->list;
+		for (int remaining = m_index->have; --remaining && here[1].out <= file_offset;)
+			here++;
+		std::memcpy(&m_read_point, here, sizeof(Point));
+	}
+
+	Access snapshot = {};
+	snapshot.span = m_index->span;
+	snapshot.uncompressed_size = m_index->uncompressed_size;
+	snapshot.have = 1;
+	snapshot.size = 1;
+	snapshot.list = &m_read_point;
+	return extract(m_src, &snapshot, file_offset, static_cast<unsigned char*>(dst), read_len, &m_z_state);
 }
 
 u32 GzippedFileReader::GetBlockCount() const
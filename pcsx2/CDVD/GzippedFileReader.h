@@ -35,19 +35,40 @@ public:
 
 	void Close2() override;
 
+	std::unique_ptr<ThreadedFileReader> OpenPreloadReader() override;
+
 	u32 GetBlockCount() const override;
 
 private:
 	static constexpr int GZFILE_SPAN_DEFAULT = (1048576 * 4); /* distance between direct access points when creating a new index */
 	static constexpr int GZFILE_READ_CHUNK_SIZE = (256 * 1024); /* zlib extraction chunks size (at 0-based boundaries) */
 	static constexpr int GZFILE_CACHE_SIZE_MB = 200; /* cache size for extracted data. must be at least GZFILE_READ_CHUNK_SIZE (in MB)*/
+	static constexpr int GZFILE_CHECKPOINT_POINTS = 256; /* access points between writes of a partial index while scanning (1GB at the default span) */
 
 	// Verifies that we have an index, or try to create one
 	bool LoadOrCreateIndex();
 
+	// Starts scanning for access points in the background, resuming from a partial index if there is one.
+	// Fails if the uncompressed size can't be determined up front.
+	bool StartBackgroundIndex(const std::string& indexfile, Access* partial);
+	void StopBackgroundIndex();
+	void BackgroundIndexThread();
+	static int AddBackgroundIndexPoint(void* ctx, int bits, s64 in, s64 out, unsigned left, unsigned char* window);
+
 	Access* m_index = nullptr; // Quick access index
 
 	RFILE* m_src = nullptr;
 
 	zstate m_z_state = {};
+
+	// While the index is built in the background, m_index->list grows under m_index_mutex, and
+	// reads decode from a copy of the closest access point.
+	std::thread m_index_thread;
+	std::mutex m_index_mutex;
+	std::atomic_bool m_index_cancel{false};
+	std::atomic_bool m_index_complete{true};
+	std::string m_index_filename;
+	RFILE* m_index_src = nullptr;
+	int m_index_checkpoint_have = 0;
+	Point m_read_point;
 };
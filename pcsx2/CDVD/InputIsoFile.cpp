@@ -22,9 +22,17 @@
 #include "CsoFileReader.h"
 #include "FlatFileReader.h"
 #include "GzippedFileReader.h"
+#include "ZstdFileReader.h"
 #include "IsoFileFormats.h"
+#include "IsoFS/IsoFS.h"
 #include "Config.h"
 
+#include <algorithm>
+#include <unordered_set>
+
+// Default upper limit for a single prefetch, of the rest of a file or after a seek
+static constexpr u32 PREFETCH_BUDGET = 32 * _1mb;
+
 static std::unique_ptr<ThreadedFileReader> GetFileReader(const char *path)
 {
 	const char *extension = path_get_extension(path);
@@ -38,10 +46,13 @@ static std::unique_ptr<ThreadedFileReader> GetFileReader(const char *path)
 		if (       (Strncasecmp(extension, "cso", 3) == 0) 
 			|| (Strncasecmp(extension, "zso", 3) == 0))
 			return std::make_unique<CsoFileReader>();
+
+		if (Strncasecmp(extension, "zst", 3) == 0)
+			return std::make_unique<ZstdFileReader>();
 	}
 	else if (ext_length == 2)
 	{
-		if (Strncasecmp(extension, "gz", 2))
+		if (Strncasecmp(extension, "gz", 2) == 0)
 			return std::make_unique<GzippedFileReader>();
 	}
 
@@ -72,10 +83,115 @@ void InputIsoFile::BeginRead2(uint lsn)
 
 	m_read_lsn = lsn;
 
+	PrefetchFile(lsn);
+
+	// No need to involve the read thread, FinishRead3 copies straight from the image.
+	m_mapped_sector = m_reader->GetMappedSector(lsn);
+	if (m_mapped_sector)
+		return;
+
 	m_reader->BeginRead(m_readbuffer, m_read_lsn, 1);
 	m_read_inprogress = true;
 }
 
+void InputIsoFile::Prefetch(uint lsn, uint count)
+{
+	if (lsn < m_blocks && !PrefetchFile(lsn))
+	{
+		count = std::min({count, m_prefetch_budget / m_blocksize, m_blocks - lsn});
+		if (count > 0)
+			m_reader->Prefetch(lsn, count);
+	}
+}
+
+// Prefetches the rest of the file containing lsn, up to m_prefetch_budget, unless that part of the
+// file was prefetched before. Returns false if lsn isn't part of a file.
+bool InputIsoFile::PrefetchFile(uint lsn)
+{
+	auto it = std::upper_bound(m_files.begin(), m_files.end(), lsn,
+		[](uint lsn, const FileExtent& file) { return lsn < file.lsn; });
+	if (it == m_files.begin())
+		return false;
+	--it;
+	if (lsn >= it->lsn + it->blocks)
+		return false;
+
+	// Going back over sectors which were prefetched before doesn't restart anything, the reader's own
+	// readahead covers rereads. Only reads past what was fetched continue the prefetch.
+	if (lsn < it->prefetched_end)
+		return true;
+
+	const u32 count = std::min({it->lsn + it->blocks - lsn, m_prefetch_budget / m_blocksize, m_blocks - lsn});
+	if (count == 0)
+		return true;
+	it->prefetched_end = lsn + count;
+	m_reader->Prefetch(lsn, count);
+	return true;
+}
+
+namespace
+{
+	// Reads ISO9660 user data for IsoDirectory, before the image is hooked up to CDVD
+	class IsoFileSectorSource final : public SectorSource
+	{
+	public:
+		explicit IsoFileSectorSource(InputIsoFile& iso)
+			: m_iso(iso)
+		{
+		}
+
+		bool readSector(unsigned char* buffer, int lba) override
+		{
+			u8 raw[CD_FRAMESIZE_RAW];
+			if (m_iso.ReadSync(raw, lba) < 0)
+				return false;
+			memcpy(buffer, raw + 24, 2048);
+			return true;
+		}
+
+	private:
+		InputIsoFile& m_iso;
+	};
+} // namespace
+
+void InputIsoFile::BuildFileMap()
+{
+	m_files.clear();
+	if (m_type != ISOTYPE_CD && m_type != ISOTYPE_DVD && m_type != ISOTYPE_DVDDL)
+		return;
+
+	IsoFileSectorSource source(*this);
+	IsoDirectory root(source);
+	if (!root.OpenRootDirectory())
+		return;
+
+	// Walk the whole tree, guarding against directories that loop back on themselves.
+	std::vector<IsoFileDescriptor> pending(root.files);
+	std::unordered_set<u32> visited;
+	while (!pending.empty())
+	{
+		const IsoFileDescriptor entry(std::move(pending.back()));
+		pending.pop_back();
+
+		if (entry.name == "." || entry.name == "..")
+			continue;
+
+		if (entry.IsFile())
+		{
+			if (entry.size > 0 && entry.lba < m_blocks)
+				m_files.push_back({entry.lba, (entry.size + 2047) / 2048, 0});
+			continue;
+		}
+
+		IsoDirectory dir(source);
+		if (visited.insert(entry.lba).second && dir.Open(entry))
+			pending.insert(pending.end(), dir.files.begin(), dir.files.end());
+	}
+
+	std::sort(m_files.begin(), m_files.end(),
+		[](const FileExtent& lhs, const FileExtent& rhs) { return lhs.lsn < rhs.lsn; });
+}
+
 int InputIsoFile::FinishRead3(u8* dst, uint mode)
 {
 	// Do nothing for out of bounds disc sector reads. It prevents some games
@@ -139,7 +255,7 @@ int InputIsoFile::FinishRead3(u8* dst, uint mode)
 
 	length = end - _offset;
 
-	memcpy(dst + diff, m_readbuffer + ndiff, length);
+	memcpy(dst + diff, (m_mapped_sector ? m_mapped_sector : m_readbuffer) + ndiff, length);
 
 	if (m_type == ISOTYPE_CD && diff >= 12)
 	{
@@ -152,6 +268,8 @@ int InputIsoFile::FinishRead3(u8* dst, uint mode)
 
 InputIsoFile::InputIsoFile()
 {
+	m_cache_size = 0;
+	m_prefetch_budget = PREFETCH_BUDGET;
 	_init();
 }
 
@@ -173,17 +291,22 @@ void InputIsoFile::_init()
 	m_read_inprogress = false;
 	m_current_lsn = -1;
 	m_read_lsn = -1;
+	m_mapped_sector = nullptr;
+
+	m_files.clear();
 
 	m_reader.reset();
 }
 
-bool InputIsoFile::Open(std::string srcfile)
+bool InputIsoFile::Open(std::string srcfile, bool preload)
 {
 	Close();
 	m_filename = std::move(srcfile);
 
 	m_reader = GetFileReader(m_filename.c_str());
-	if (!m_reader->Open(m_filename))
+	if (m_cache_size)
+		m_reader->SetCacheSize(m_cache_size);
+	if (!m_reader->Open(m_filename, preload))
 		return false;
 
 	if (!Detect())
@@ -194,9 +317,22 @@ bool InputIsoFile::Open(std::string srcfile)
 
 	m_blocks = m_reader->GetBlockCount();
 
+	BuildFileMap();
+
 	return true;
 }
 
+void InputIsoFile::SetReadSettings(u32 cache_size, u32 prefetch_budget)
+{
+	m_cache_size = cache_size;
+	m_prefetch_budget = prefetch_budget;
+}
+
+u32 InputIsoFile::GetCacheSize() const
+{
+	return m_reader ? m_reader->GetCacheSize() : m_cache_size;
+}
+
 void InputIsoFile::Close()
 {
 	if (m_reader)
@@ -19,6 +19,7 @@
 #include "ThreadedFileReader.h"
 #include <memory>
 #include <string>
+#include <vector>
 
 enum isoType
 {
@@ -57,6 +58,22 @@ protected:
 	bool m_read_inprogress;
 	uint m_read_lsn;
 	u8 m_readbuffer[CD_FRAMESIZE_RAW];
+	// Points straight into the image instead of m_readbuffer when the reader has it mapped
+	const u8* m_mapped_sector;
+
+	struct FileExtent
+	{
+		u32 lsn;
+		u32 blocks;
+		// End of the sectors already prefetched, so each part of a file is only prefetched once
+		u32 prefetched_end;
+	};
+	// ISO9660 files sorted by their first sector, so reads can be matched to the file they belong to
+	std::vector<FileExtent> m_files;
+
+	// Reader settings, kept across Open() calls. A cache size of 0 leaves the reader's default.
+	u32 m_cache_size;
+	u32 m_prefetch_budget;
 
 public:
 	InputIsoFile();
@@ -66,7 +83,12 @@ public:
 	uint GetBlockCount() const { return m_blocks; }
 	int GetBlockOffset() const { return m_blockofs; }
 
-	bool Open(std::string srcfile);
+	bool Open(std::string srcfile, bool preload);
+	// Sets the readahead buffer size for the next Open(), and the most that's prefetched at once,
+	// 0 to disable prefetching. Meant for benchmarking, games use the defaults.
+	void SetReadSettings(u32 cache_size, u32 prefetch_budget);
+	u32 GetCacheSize() const;
+	u32 GetPrefetchBudget() const { return m_prefetch_budget; }
 	void Close();
 	bool Detect(void);
 
@@ -74,10 +96,14 @@ public:
 
 	void BeginRead2(uint lsn);
 	int FinishRead3(u8* dest, uint mode);
+	void Prefetch(uint lsn, uint count);
 
 protected:
 	void _init();
 
 	bool tryIsoType(u32 size, u32 offset, u32 blockofs);
 	void FindParts();
+
+	void BuildFileMap();
+	bool PrefetchFile(uint lsn);
 };
@@ -17,7 +17,11 @@
 #include <cstring>
 
 #include "ThreadedFileReader.h"
+#include "../Host.h"
 
+#include "common/Console.h"
+#include "common/General.h"
+#include "common/StringUtil.h"
 #include "common/Threading.h"
 
 // Make sure buffer size is bigger than the cutoff where PCSX2 emulates a seek
@@ -25,12 +29,14 @@
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
 
 ThreadedFileReader::ThreadedFileReader()
+	: m_bufferSize(MINIMUM_SIZE)
 {
 	m_readThread = std::thread([](ThreadedFileReader* r){ r->Loop(); }, this);
 }
 
 ThreadedFileReader::~ThreadedFileReader()
 {
+	StopPrefetch();
 	m_quit = true;
 	(void)std::lock_guard<std::mutex>{m_mtx};
 	m_condition.notify_one();
@@ -46,12 +52,21 @@ void ThreadedFileReader::Loop()
 
 	for (;;)
 	{
-		while (!m_requestSize && !m_quit)
+		while (!m_requestSize && !m_preloadRetry && !m_quit)
 			m_condition.wait(lock);
 
 		if (m_quit)
 			return;
 
+		if (m_preloadRetry)
+		{
+			// Decompress() uses the preload state without locking on this thread, so only change it from here.
+			m_preloadRetry = false;
+			StartPreload();
+			if (!m_requestSize)
+				continue;
+		}
+
 		u64 requestOffset;
 		u32 requestSize;
 
@@ -81,7 +96,7 @@ void ThreadedFileReader::Loop()
 			break;
 		}
 
-		if (ok)
+		if (ok && !IsPreloadComplete())
 		{
 			// Readahead
 			Chunk chunk = ChunkForOffset(requestOffset + requestSize);
@@ -145,7 +160,7 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 		std::unique_lock<std::mutex> lock(m_mtx, std::defer_lock);
 		if (std::this_thread::get_id() == m_readThread.get_id())
 			lock.lock();
-		u32 size = std::max(block.length, MINIMUM_SIZE);
+		u32 size = std::max(block.length, m_bufferSize);
 		if (buf.cap < size)
 		{
 			buf.ptr = realloc(buf.ptr, size);
@@ -166,6 +181,11 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 
 bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 {
+	if (m_preloadData && TryPreloadedRead(target, begin, size))
+		return true;
+	if (TryPrefetchedRead(target, begin, size))
+		return true;
+
 	char* write   = static_cast<char*>(target);
 	u32 remaining = size;
 	u64 off       = begin;
@@ -300,10 +320,358 @@ bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, co
 	return allDone;
 }
 
-bool ThreadedFileReader::Open(std::string filename)
+bool ThreadedFileReader::Open(std::string filename, bool preload)
 {
 	CancelAndWaitUntilStopped();
-	return Open2(std::move(filename));
+	if (!Open2(std::move(filename)))
+		return false;
+
+	StartPrefetch();
+	if (preload)
+		StartPreload();
+
+	return true;
+}
+
+void ThreadedFileReader::StartPreload()
+{
+	// Chunk IDs need to be dense so they can index the ready flags.
+	u64 total_size = 0;
+	for (;;)
+	{
+		const Chunk chunk = ChunkForOffset(total_size);
+		if (chunk.chunkID < 0 || chunk.length == 0)
+			break;
+		if (chunk.chunkID != static_cast<s64>(m_preloadChunks.size()) || chunk.offset != total_size)
+		{
+			Console.Warning("CDVD: Can't preload '%s', unexpected chunk layout.", m_filename.c_str());
+			m_preloadChunks.clear();
+			return;
+		}
+
+		m_preloadChunks.push_back(chunk);
+		total_size = chunk.offset + chunk.length;
+	}
+
+	// Leave at least half of the host's memory for everything else.
+	const u64 total_memory = HostSys::GetTotalPhysicalMemory();
+	if (m_preloadChunks.empty() || (total_memory != 0 && total_size > total_memory / 2))
+	{
+		Host::AddOSDMessage(StringUtil::StdStringFromFormat("Not enough memory to preload disc (%llu MB).",
+			static_cast<unsigned long long>(total_size / _1mb)), 5.0f);
+		m_preloadChunks.clear();
+		return;
+	}
+
+	m_preloadData.reset(new (std::nothrow) u8[total_size]);
+	if (!m_preloadData)
+	{
+		Console.Error("CDVD: Failed to allocate %llu bytes for disc preload.", static_cast<unsigned long long>(total_size));
+		m_preloadChunks.clear();
+		return;
+	}
+	m_preloadReady = std::make_unique<std::atomic<bool>[]>(m_preloadChunks.size());
+
+	const u32 num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+	for (u32 i = 0; i < num_threads; i++)
+	{
+		std::unique_ptr<ThreadedFileReader> reader = OpenPreloadReader();
+		if (!reader)
+			break;
+
+		m_preloadThreads.emplace_back([this](std::unique_ptr<ThreadedFileReader> reader) {
+			PreloadWorker(std::move(reader));
+		}, std::move(reader));
+	}
+
+	if (m_preloadThreads.empty())
+	{
+		Console.Warning("CDVD: Preloading isn't available for '%s' yet.", m_filename.c_str());
+		StopPreload();
+		m_preloadPending = true;
+		return;
+	}
+
+	m_preloadActive.store(true, std::memory_order_relaxed);
+
+	Console.WriteLn("CDVD: Preloading %llu MB on %zu threads.", static_cast<unsigned long long>(total_size / _1mb), m_preloadThreads.size());
+	Host::AddOSDMessage(StringUtil::StdStringFromFormat("Preloading disc (%llu MB)...",
+		static_cast<unsigned long long>(total_size / _1mb)), 3.0f);
+}
+
+void ThreadedFileReader::RetryPreload()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mtx);
+		if (!m_preloadPending)
+			return;
+		m_preloadPending = false;
+		m_preloadRetry = true;
+	}
+	m_condition.notify_all();
+}
+
+void ThreadedFileReader::StopPreload()
+{
+	m_preloadActive.store(false, std::memory_order_relaxed);
+	m_preloadCancel.store(true, std::memory_order_relaxed);
+	for (std::thread& thread : m_preloadThreads)
+		thread.join();
+	m_preloadThreads.clear();
+
+	m_preloadData.reset();
+	m_preloadReady.reset();
+	m_preloadChunks.clear();
+	m_preloadNext.store(0, std::memory_order_relaxed);
+	m_preloadDone.store(0, std::memory_order_relaxed);
+	m_preloadCancel.store(false, std::memory_order_relaxed);
+}
+
+void ThreadedFileReader::PreloadWorker(std::unique_ptr<ThreadedFileReader> reader)
+{
+	const size_t count = m_preloadChunks.size();
+	const size_t progress_step = std::max<size_t>(count / 10, 1);
+
+	while (!m_preloadCancel.load(std::memory_order_relaxed))
+	{
+		const size_t index = m_preloadNext.fetch_add(1, std::memory_order_relaxed);
+		if (index >= count)
+			break;
+
+		const Chunk& chunk = m_preloadChunks[index];
+		if (reader->ReadChunk(m_preloadData.get() + chunk.offset, chunk.chunkID) <= 0)
+		{
+			// Leave it to the regular read path.
+			Console.Error("CDVD: Failed to preload chunk %lld.", static_cast<long long>(chunk.chunkID));
+			continue;
+		}
+		m_preloadReady[index].store(true, std::memory_order_release);
+
+		const size_t done = m_preloadDone.fetch_add(1, std::memory_order_relaxed) + 1;
+		if (done == count)
+			Host::AddOSDMessage("Disc preloaded into memory.", 3.0f);
+		else if (done % progress_step == 0)
+			Host::AddOSDMessage(StringUtil::StdStringFromFormat("Preloading disc: %zu%%", done * 100 / count), 1.0f);
+	}
+
+	reader->Close();
+}
+
+bool ThreadedFileReader::IsPreloadComplete() const
+{
+	return m_preloadData && m_preloadDone.load(std::memory_order_relaxed) == m_preloadChunks.size();
+}
+
+bool ThreadedFileReader::TryPreloadedRead(void* target, u64 offset, u32 size)
+{
+	const u64 end = offset + size;
+	for (u64 pos = offset; pos < end;)
+	{
+		const Chunk chunk = ChunkForOffset(pos);
+		if (chunk.chunkID < 0 || static_cast<size_t>(chunk.chunkID) >= m_preloadChunks.size() ||
+			!m_preloadReady[chunk.chunkID].load(std::memory_order_acquire))
+		{
+			return false;
+		}
+		pos = chunk.offset + chunk.length;
+	}
+
+	CopyBlocks(target, m_preloadData.get() + offset, size);
+	return true;
+}
+
+void ThreadedFileReader::CopyBlocks(void* target, const u8* src, u32 size)
+{
+	u8* dst = static_cast<u8*>(target);
+	if (m_internalBlockSize)
+	{
+		for (const u8* src_end = src + size; src < src_end; src += m_internalBlockSize, dst += m_blocksize)
+			std::memcpy(dst, src, m_blocksize);
+	}
+	else
+	{
+		std::memcpy(dst, src, size);
+		dst += size;
+	}
+
+	m_amtRead += dst - static_cast<u8*>(target);
+}
+
+void ThreadedFileReader::Prefetch(u32 sector, u32 count)
+{
+	// Nothing to gain if the whole disc is (being) loaded already.
+	if (m_preloadActive.load(std::memory_order_relaxed))
+		return;
+
+	const u32 blocksize = m_internalBlockSize ? m_internalBlockSize : m_blocksize;
+	const u64 begin = static_cast<u64>(sector) * blocksize + m_dataoffset;
+	const u64 end = begin + static_cast<u64>(count) * blocksize;
+	// Readahead keeps up with anything smaller.
+	if (end - begin < MINIMUM_SIZE)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_prefetchMutex);
+		if (!m_prefetchThread.joinable())
+			return;
+
+		if (m_prefetchRequested)
+		{
+			if (m_prefetchRequestBegin <= begin && m_prefetchRequestEnd >= end)
+				return;
+		}
+		else if (!m_prefetchChunks.empty() && m_prefetchChunks.front().offset <= begin &&
+				 m_prefetchChunks.back().offset + m_prefetchChunks.back().length >= end)
+		{
+			return;
+		}
+
+		// Everything else happens on the worker, this is called from the EE thread.
+		m_prefetchRequestBegin = begin;
+		m_prefetchRequestEnd = end;
+		m_prefetchRequested = true;
+		m_prefetchCancel.store(true, std::memory_order_relaxed);
+	}
+	m_prefetchCondition.notify_one();
+}
+
+void ThreadedFileReader::StartPrefetch()
+{
+	StopPrefetch();
+
+	std::lock_guard<std::mutex> lock(m_prefetchMutex);
+	m_prefetchQuit = false;
+	m_prefetchThread = std::thread(&ThreadedFileReader::PrefetchWorker, this);
+}
+
+void ThreadedFileReader::StopPrefetch()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_prefetchMutex);
+		m_prefetchQuit = true;
+		m_prefetchRequested = false;
+		m_prefetchCancel.store(true, std::memory_order_relaxed);
+	}
+	m_prefetchCondition.notify_one();
+	if (m_prefetchThread.joinable())
+		m_prefetchThread.join();
+
+	std::lock_guard<std::mutex> lock(m_prefetchMutex);
+	m_prefetchCancel.store(false, std::memory_order_relaxed);
+	m_prefetchChunks.clear();
+	m_prefetchReady.reset();
+	m_prefetchData.reset();
+	m_prefetchCap = 0;
+}
+
+void ThreadedFileReader::PrefetchWorker()
+{
+	std::unique_lock<std::mutex> lock(m_prefetchMutex);
+	for (;;)
+	{
+		while (!m_prefetchRequested && !m_prefetchQuit)
+			m_prefetchCondition.wait(lock);
+
+		if (m_prefetchQuit)
+			break;
+
+		m_prefetchRequested = false;
+		m_prefetchCancel.store(false, std::memory_order_relaxed);
+		PrefetchRange(m_prefetchRequestBegin, m_prefetchRequestEnd, lock);
+	}
+	lock.unlock();
+
+	if (m_prefetchReader)
+	{
+		m_prefetchReader->Close();
+		m_prefetchReader.reset();
+	}
+}
+
+void ThreadedFileReader::PrefetchRange(u64 begin, u64 end, std::unique_lock<std::mutex>& lock)
+{
+	// Readers stop using the old range here, so its buffer can be reused without the lock.
+	m_prefetchChunks.clear();
+	m_prefetchReady.reset();
+	lock.unlock();
+
+	// Formats can't always open a second reader straight away, so keep trying with later requests.
+	if (!m_prefetchReader)
+		m_prefetchReader = OpenPreloadReader();
+
+	std::vector<Chunk> chunks;
+	for (u64 pos = begin; m_prefetchReader && pos < end;)
+	{
+		const Chunk chunk = ChunkForOffset(pos);
+		if (chunk.chunkID < 0 || chunk.length == 0)
+			break;
+		// Lookups index by chunk ID, so they need to be consecutive.
+		if (!chunks.empty() && chunk.chunkID != chunks.back().chunkID + 1)
+			break;
+		chunks.push_back(chunk);
+		pos = chunk.offset + chunk.length;
+	}
+
+	const u64 size = chunks.empty() ? 0 : (chunks.back().offset + chunks.back().length - chunks.front().offset);
+	if (m_prefetchCap < size)
+	{
+		m_prefetchData.reset();
+		m_prefetchData.reset(new (std::nothrow) u8[size]);
+		m_prefetchCap = m_prefetchData ? size : 0;
+	}
+	std::unique_ptr<std::atomic<bool>[]> ready = std::make_unique<std::atomic<bool>[]>(chunks.size());
+
+	lock.lock();
+	if (chunks.empty() || m_prefetchCap < size || m_prefetchRequested || m_prefetchQuit)
+		return;
+
+	m_prefetchChunks = std::move(chunks);
+	m_prefetchReady = std::move(ready);
+	lock.unlock();
+
+	// Only this thread changes the range, so it can be read without the lock.
+	const u64 base = m_prefetchChunks.front().offset;
+	for (size_t i = 0; i < m_prefetchChunks.size(); i++)
+	{
+		if (m_prefetchCancel.load(std::memory_order_relaxed))
+			break;
+
+		const Chunk& chunk = m_prefetchChunks[i];
+		if (m_prefetchReader->ReadChunk(m_prefetchData.get() + (chunk.offset - base), chunk.chunkID) <= 0)
+		{
+			// Leave it to the regular read path.
+			Console.Error("CDVD: Failed to prefetch chunk %lld.", static_cast<long long>(chunk.chunkID));
+			break;
+		}
+		m_prefetchReady[i].store(true, std::memory_order_release);
+	}
+
+	lock.lock();
+}
+
+bool ThreadedFileReader::TryPrefetchedRead(void* target, u64 offset, u32 size)
+{
+	// Don't hold up the read if a new prefetch is being set up, just read it normally.
+	std::unique_lock<std::mutex> lock(m_prefetchMutex, std::try_to_lock);
+	if (!lock.owns_lock() || m_prefetchChunks.empty())
+		return false;
+
+	const s64 first_id = m_prefetchChunks.front().chunkID;
+	const u64 end = offset + size;
+	for (u64 pos = offset; pos < end;)
+	{
+		const Chunk chunk = ChunkForOffset(pos);
+		const s64 index = chunk.chunkID - first_id;
+		if (chunk.chunkID < 0 || index < 0 || static_cast<size_t>(index) >= m_prefetchChunks.size() ||
+			!m_prefetchReady[index].load(std::memory_order_acquire))
+		{
+			return false;
+		}
+		pos = chunk.offset + chunk.length;
+	}
+
+	CopyBlocks(target, m_prefetchData.get() + (offset - m_prefetchChunks.front().offset), size);
+	return true;
 }
 
 int ThreadedFileReader::ReadSync(void* pBuffer, u32 sector, u32 count)
@@ -409,7 +777,14 @@ void ThreadedFileReader::CancelRead(void)
 
 void ThreadedFileReader::Close(void)
 {
+	{
+		std::lock_guard<std::mutex> lock(m_mtx);
+		m_preloadPending = false;
+		m_preloadRetry = false;
+	}
 	CancelAndWaitUntilStopped();
+	StopPreload();
+	StopPrefetch();
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
 	Close2();
@@ -424,3 +799,10 @@ void ThreadedFileReader::SetDataOffset(u32 bytes)
 {
 	m_dataoffset = bytes;
 }
+
+void ThreadedFileReader::SetCacheSize(u32 bytes)
+{
+	// Buffers are grown the next time they're filled.
+	std::lock_guard<std::mutex> lock(m_mtx);
+	m_bufferSize = std::max(bytes, MINIMUM_SIZE);
+}
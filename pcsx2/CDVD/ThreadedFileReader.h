@@ -23,7 +23,9 @@
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
 #include <condition_variable>
 
 /// A file reader for use with compressed formats
@@ -58,6 +60,12 @@ protected:
 	virtual bool Open2(std::string filename) = 0;
 	/// AsyncFileReader close but ThreadedFileReader needs prep work first
 	virtual void Close2() = 0;
+	/// Opens an independent reader on the same file, so the disc can be preloaded on several threads
+	/// Returns null if the format can't do that (right now)
+	virtual std::unique_ptr<ThreadedFileReader> OpenPreloadReader() { return {}; }
+	/// Call once OpenPreloadReader() can succeed, if it couldn't before (e.g. an index finished building)
+	/// Starts the preload on the read thread if one was requested when the file was opened
+	void RetryPreload();
 
 	ThreadedFileReader();
 
@@ -84,6 +92,8 @@ private:
 	/// 2 buffers for readahead (current block, next block)
 	Buffer m_buffer[2];
 	u32 m_nextBuffer = 0;
+	/// Size of each readahead buffer, see SetCacheSize(), view while holding `m_mtx`
+	u32 m_bufferSize;
 
 	std::thread m_readThread;
 	std::mutex m_mtx;
@@ -94,9 +104,68 @@ private:
 	/// View while holding `m_mtx`.  If false, you may touch decompression functions from other threads
 	bool m_running = false;
 
+	/// Whole-disc preload, filled in by worker threads with their own readers
+	/// Chunks can be served from `m_preloadData` once their `m_preloadReady` flag is set
+	std::unique_ptr<u8[]> m_preloadData;
+	std::unique_ptr<std::atomic<bool>[]> m_preloadReady;
+	std::vector<Chunk> m_preloadChunks;
+	std::vector<std::thread> m_preloadThreads;
+	std::atomic<bool> m_preloadCancel{false};
+	std::atomic<size_t> m_preloadNext{0};
+	std::atomic<size_t> m_preloadDone{0};
+	/// Set once `m_preloadData` is in use, for checks from threads which don't hold `m_mtx`
+	std::atomic<bool> m_preloadActive{false};
+	/// True if a preload was requested but no preload readers could be opened yet, view while holding `m_mtx`
+	bool m_preloadPending = false;
+	/// True to tell the read thread to start the pending preload, view while holding `m_mtx`
+	bool m_preloadRetry = false;
+
 	/// Main loop of read thread
 	void Loop();
 
+	/// Starts decompressing the whole disc into memory in the background
+	void StartPreload();
+	/// Stops preloading and releases the preloaded data
+	void StopPreload();
+	/// Preload worker thread, decompresses chunks using its own reader
+	void PreloadWorker(std::unique_ptr<ThreadedFileReader> reader);
+	bool IsPreloadComplete() const;
+	/// Copies the given range from preloaded data if all of it is available
+	bool TryPreloadedRead(void* target, u64 offset, u32 size);
+
+	/// Range prefetch (e.g. the rest of the file the game is reading), filled in by a worker thread with its own reader
+	/// Chunks can be served from `m_prefetchData` once their `m_prefetchReady` flag is set, while holding `m_prefetchMutex`
+	/// The worker runs for as long as the file is open, Prefetch() only hands it the range to fetch next
+	std::mutex m_prefetchMutex;
+	std::condition_variable m_prefetchCondition;
+	std::unique_ptr<ThreadedFileReader> m_prefetchReader;
+	std::unique_ptr<u8[]> m_prefetchData;
+	u64 m_prefetchCap = 0;
+	std::unique_ptr<std::atomic<bool>[]> m_prefetchReady;
+	std::vector<Chunk> m_prefetchChunks;
+	std::thread m_prefetchThread;
+	/// Set when a new range replaces the one being fetched
+	std::atomic<bool> m_prefetchCancel{false};
+	/// Next range to fetch, view while holding `m_prefetchMutex`
+	u64 m_prefetchRequestBegin = 0;
+	u64 m_prefetchRequestEnd = 0;
+	bool m_prefetchRequested = false;
+	/// True to tell the prefetch worker to exit, view while holding `m_prefetchMutex`
+	bool m_prefetchQuit = false;
+
+	/// Prefetch worker thread, waits for ranges from Prefetch() and decompresses them
+	void PrefetchWorker();
+	/// Decompresses the given range into `m_prefetchData`, call from the prefetch worker with `lock` held
+	void PrefetchRange(u64 begin, u64 end, std::unique_lock<std::mutex>& lock);
+	/// Starts the prefetch worker
+	void StartPrefetch();
+	/// Stops the prefetch worker and releases the prefetched data
+	void StopPrefetch();
+	/// Copies the given range from prefetched data if all of it is available
+	bool TryPrefetchedRead(void* target, u64 offset, u32 size);
+	/// Copies size bytes of chunk data to target, dropping the padding of internal blocks
+	void CopyBlocks(void* target, const u8* src, u32 size);
+
 	/// Load the given block into one of the `m_buffer` buffers if necessary and return a pointer to its contents if successful
 	Buffer* GetBlockPtr(const Chunk& block);
 	/// Decompress from offset to size into
@@ -113,7 +182,8 @@ public:
 
 	virtual u32 GetBlockCount() const = 0;
 
-	bool Open(std::string filename);
+	/// Set `preload` to decompress the whole disc into memory in the background
+	bool Open(std::string filename, bool preload);
 	int ReadSync(void* pBuffer, u32 sector, u32 count);
 	void BeginRead(void* pBuffer, u32 sector, u32 count);
 	int FinishRead();
@@ -121,4 +191,15 @@ public:
 	void Close();
 	void SetBlockSize(u32 bytes);
 	void SetDataOffset(u32 bytes);
+	/// Sets how much each of the two readahead buffers holds, which is also how far the reader reads ahead
+	/// Sizes below the default are rounded up to it
+	void SetCacheSize(u32 bytes);
+	u32 GetCacheSize() const { return m_bufferSize; }
+
+	/// Returns a pointer to the given sector if the whole image is mapped into memory, otherwise null
+	/// Mapped sectors can be copied from directly, bypassing the read thread
+	virtual const u8* GetMappedSector(u32 sector) const { return nullptr; }
+	/// Hint that the given sectors are about to be read, e.g. because the drive is seeking to them
+	/// Large ranges are decompressed into memory in the background, if the format supports a second reader
+	virtual void Prefetch(u32 sector, u32 count);
 };
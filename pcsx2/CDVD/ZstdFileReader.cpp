@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "ZstdFileReader.h"
+
+#include "common/Console.h"
+#include "common/StringUtil.h"
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+
+static constexpr u32 ZSTD_SEEKABLE_MAGIC = 0x8F92EAB1;
+static constexpr u32 ZSTD_SEEK_TABLE_MAGIC = 0x184D2A5E;
+/// Our own skippable frame type, holding the dictionary used to compress the data frames
+static constexpr u32 ZSTD_DICTIONARY_MAGIC = 0x184D2A5D;
+static constexpr u32 ZSTD_SKIPPABLE_HEADER_SIZE = 8;
+static constexpr u32 ZSTD_SEEK_TABLE_FOOTER_SIZE = 9;
+
+/// Sanity limits, anything bigger than this wasn't made for random access
+static constexpr u32 ZSTD_MAX_FRAME_SIZE = 16 * 1024 * 1024;
+static constexpr u32 ZSTD_MAX_DICTIONARY_SIZE = 16 * 1024 * 1024;
+
+static u32 ReadLE32(const u8* ptr)
+{
+	return static_cast<u32>(ptr[0]) | (static_cast<u32>(ptr[1]) << 8) | (static_cast<u32>(ptr[2]) << 16) |
+		   (static_cast<u32>(ptr[3]) << 24);
+}
+
+ZstdFileReader::ZstdFileReader() = default;
+
+ZstdFileReader::~ZstdFileReader()
+{
+	Close2();
+}
+
+bool ZstdFileReader::CanHandle(const std::string& fileName, const std::string& displayName)
+{
+	if (!StringUtil::EndsWith(displayName, ".zst"))
+		return false;
+
+	RFILE* fp = FileSystem::OpenFile(fileName.c_str(), "rb");
+	if (!fp)
+		return false;
+
+	bool supported = false;
+	u8 footer[ZSTD_SEEK_TABLE_FOOTER_SIZE];
+	const s64 size = FileSystem::FSize64(fp);
+	if (size >= ZSTD_SEEK_TABLE_FOOTER_SIZE && FileSystem::FSeek64(fp, size - ZSTD_SEEK_TABLE_FOOTER_SIZE, SEEK_SET) == 0 &&
+		rfread(footer, 1, sizeof(footer), fp) == sizeof(footer))
+	{
+		supported = ReadLE32(footer + 5) == ZSTD_SEEKABLE_MAGIC;
+	}
+	rfclose(fp);
+	return supported;
+}
+
+bool ZstdFileReader::Open2(std::string filename)
+{
+	Close2();
+	m_filename = std::move(filename);
+	m_src = FileSystem::OpenFile(m_filename.c_str(), "rb");
+
+	u64 data_start = 0;
+	if (!m_src || !ReadDictionary(&data_start) || !ReadSeekTable(data_start))
+	{
+		Close2();
+		return false;
+	}
+
+	m_dctx = ZSTD_createDCtx();
+	if (!m_dctx)
+	{
+		Console.Error("Unable to initialize zstd for decompression.");
+		Close2();
+		return false;
+	}
+
+	return true;
+}
+
+bool ZstdFileReader::ReadDictionary(u64* data_start)
+{
+	u8 header[ZSTD_SKIPPABLE_HEADER_SIZE];
+	if (FileSystem::FSeek64(m_src, 0, SEEK_SET) != 0 || rfread(header, 1, sizeof(header), m_src) != sizeof(header))
+	{
+		Console.Error("Failed to read zstd file header.");
+		return false;
+	}
+
+	*data_start = 0;
+	if (ReadLE32(header) != ZSTD_DICTIONARY_MAGIC)
+		return true;
+
+	const u32 dict_size = ReadLE32(header + 4);
+	if (dict_size == 0 || dict_size > ZSTD_MAX_DICTIONARY_SIZE)
+	{
+		Console.Error("zstd image has an invalid dictionary size (%u).", dict_size);
+		return false;
+	}
+
+	std::unique_ptr<u8[]> dict = std::make_unique<u8[]>(dict_size);
+	if (rfread(dict.get(), 1, dict_size, m_src) != dict_size)
+	{
+		Console.Error("Failed to read zstd dictionary.");
+		return false;
+	}
+
+	m_ddict = ZSTD_createDDict(dict.get(), dict_size);
+	if (!m_ddict)
+	{
+		Console.Error("Failed to load zstd dictionary.");
+		return false;
+	}
+
+	*data_start = ZSTD_SKIPPABLE_HEADER_SIZE + dict_size;
+	return true;
+}
+
+bool ZstdFileReader::ReadSeekTable(u64 data_start)
+{
+	const s64 file_size = FileSystem::FSize64(m_src);
+	u8 footer[ZSTD_SEEK_TABLE_FOOTER_SIZE];
+	if (file_size < static_cast<s64>(data_start + ZSTD_SKIPPABLE_HEADER_SIZE + ZSTD_SEEK_TABLE_FOOTER_SIZE) ||
+		FileSystem::FSeek64(m_src, file_size - ZSTD_SEEK_TABLE_FOOTER_SIZE, SEEK_SET) != 0 ||
+		rfread(footer, 1, sizeof(footer), m_src) != sizeof(footer))
+	{
+		Console.Error("Failed to read zstd seek table footer.");
+		return false;
+	}
+
+	const u32 num_frames = ReadLE32(footer);
+	const u8 descriptor = footer[4];
+	if (ReadLE32(footer + 5) != ZSTD_SEEKABLE_MAGIC || (descriptor & 0x7C) != 0 || num_frames == 0)
+	{
+		Console.Error("zstd image has no valid seek table. Only seekable zstd images are supported.");
+		return false;
+	}
+
+	// Per-frame checksums are optional, and zstd frames can carry their own.
+	const u32 entry_size = (descriptor & 0x80) ? 12 : 8;
+	const u64 table_size = static_cast<u64>(num_frames) * entry_size;
+	const u64 table_frame_size = ZSTD_SKIPPABLE_HEADER_SIZE + table_size + ZSTD_SEEK_TABLE_FOOTER_SIZE;
+	if (table_frame_size > static_cast<u64>(file_size) - data_start)
+	{
+		Console.Error("zstd seek table is larger than the file.");
+		return false;
+	}
+
+	std::vector<u8> table(ZSTD_SKIPPABLE_HEADER_SIZE + table_size);
+	if (FileSystem::FSeek64(m_src, file_size - table_frame_size, SEEK_SET) != 0 ||
+		rfread(table.data(), 1, table.size(), m_src) != table.size())
+	{
+		Console.Error("Failed to read zstd seek table.");
+		return false;
+	}
+
+	if (ReadLE32(table.data()) != ZSTD_SEEK_TABLE_MAGIC ||
+		ReadLE32(table.data() + 4) != table_size + ZSTD_SEEK_TABLE_FOOTER_SIZE)
+	{
+		Console.Error("zstd seek table header is corrupted.");
+		return false;
+	}
+
+	m_compressedOffsets.resize(num_frames + 1);
+	m_uncompressedOffsets.resize(num_frames + 1);
+	m_compressedOffsets[0] = data_start;
+	m_uncompressedOffsets[0] = 0;
+
+	u32 max_compressed_size = 0;
+	const u8* entry = table.data() + ZSTD_SKIPPABLE_HEADER_SIZE;
+	for (u32 i = 0; i < num_frames; i++, entry += entry_size)
+	{
+		const u32 compressed_size = ReadLE32(entry);
+		const u32 uncompressed_size = ReadLE32(entry + 4);
+		if (compressed_size == 0 || uncompressed_size == 0 || compressed_size > ZSTD_MAX_FRAME_SIZE ||
+			uncompressed_size > ZSTD_MAX_FRAME_SIZE)
+		{
+			Console.Error("zstd seek table entry %u is invalid.", i);
+			return false;
+		}
+
+		m_compressedOffsets[i + 1] = m_compressedOffsets[i] + compressed_size;
+		m_uncompressedOffsets[i + 1] = m_uncompressedOffsets[i] + uncompressed_size;
+		max_compressed_size = std::max(max_compressed_size, compressed_size);
+	}
+
+	if (m_compressedOffsets[num_frames] != static_cast<u64>(file_size) - table_frame_size)
+	{
+		Console.Error("zstd seek table doesn't match the file size.");
+		return false;
+	}
+
+	m_readBuffer = std::make_unique<u8[]>(max_compressed_size);
+	return true;
+}
+
+std::unique_ptr<ThreadedFileReader> ZstdFileReader::OpenPreloadReader()
+{
+	auto reader = std::make_unique<ZstdFileReader>();
+	if (!reader->Open2(m_filename))
+		return {};
+	return reader;
+}
+
+ThreadedFileReader::Chunk ZstdFileReader::ChunkForOffset(u64 offset)
+{
+	Chunk chunk = {};
+	if (m_uncompressedOffsets.empty() || offset >= m_uncompressedOffsets.back())
+	{
+		chunk.chunkID = -1;
+	}
+	else
+	{
+		// Frames don't have to be the same size, so find the last one starting at or before offset.
+		const auto it = std::upper_bound(m_uncompressedOffsets.begin(), m_uncompressedOffsets.end(), offset) - 1;
+		chunk.chunkID = it - m_uncompressedOffsets.begin();
+		chunk.offset = *it;
+		chunk.length = static_cast<u32>(*(it + 1) - *it);
+	}
+	return chunk;
+}
+
+int ZstdFileReader::ReadChunk(void* dst, s64 chunkID)
+{
+	if (chunkID < 0 || static_cast<size_t>(chunkID) + 1 >= m_compressedOffsets.size())
+		return -1;
+
+	const u64 compressed_pos = m_compressedOffsets[chunkID];
+	const u32 compressed_size = static_cast<u32>(m_compressedOffsets[chunkID + 1] - compressed_pos);
+	const u32 uncompressed_size = static_cast<u32>(m_uncompressedOffsets[chunkID + 1] - m_uncompressedOffsets[chunkID]);
+
+	if (FileSystem::FSeek64(m_src, compressed_pos, SEEK_SET) != 0 ||
+		rfread(m_readBuffer.get(), 1, compressed_size, m_src) != compressed_size)
+	{
+		Console.Error("Unable to read zstd frame %lld.", static_cast<long long>(chunkID));
+		return 0;
+	}
+
+	const size_t result = m_ddict ?
+		ZSTD_decompress_usingDDict(m_dctx, dst, uncompressed_size, m_readBuffer.get(), compressed_size, m_ddict) :
+		ZSTD_decompressDCtx(m_dctx, dst, uncompressed_size, m_readBuffer.get(), compressed_size);
+	if (ZSTD_isError(result) || result != uncompressed_size)
+	{
+		Console.Error("Unable to decompress zstd frame %lld: %s", static_cast<long long>(chunkID),
+			ZSTD_isError(result) ? ZSTD_getErrorName(result) : "size mismatch");
+		return 0;
+	}
+
+	return static_cast<int>(uncompressed_size);
+}
+
+void ZstdFileReader::Close2()
+{
+	if (m_src)
+	{
+		rfclose(m_src);
+		m_src = nullptr;
+	}
+	if (m_dctx)
+	{
+		ZSTD_freeDCtx(m_dctx);
+		m_dctx = nullptr;
+	}
+	if (m_ddict)
+	{
+		ZSTD_freeDDict(m_ddict);
+		m_ddict = nullptr;
+	}
+
+	m_compressedOffsets.clear();
+	m_uncompressedOffsets.clear();
+	m_readBuffer.reset();
+}
+
+u32 ZstdFileReader::GetBlockCount() const
+{
+	if (m_uncompressedOffsets.empty())
+		return 0;
+
+	return static_cast<u32>((m_uncompressedOffsets.back() - m_dataoffset) / m_blocksize);
+}
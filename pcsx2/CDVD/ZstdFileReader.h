@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: LGPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include "common/FileSystem.h"
+
+#include "CDVD/ThreadedFileReader.h"
+
+#include <memory>
+#include <vector>
+
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+typedef struct ZSTD_DDict_s ZSTD_DDict;
+
+/// Reader for images in the zstd seekable format:
+/// https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+/// Optionally, the first frame may be a skippable frame holding a dictionary the data frames were compressed with.
+class ZstdFileReader final : public ThreadedFileReader
+{
+	DeclareNoncopyableObject(ZstdFileReader);
+
+public:
+	ZstdFileReader();
+	~ZstdFileReader() override;
+
+	static bool CanHandle(const std::string& fileName, const std::string& displayName);
+
+	bool Open2(std::string filename) override;
+
+	Chunk ChunkForOffset(u64 offset) override;
+	int ReadChunk(void* dst, s64 chunkID) override;
+
+	void Close2() override;
+
+	std::unique_ptr<ThreadedFileReader> OpenPreloadReader() override;
+
+	u32 GetBlockCount() const override;
+
+private:
+	bool ReadDictionary(u64* data_start);
+	bool ReadSeekTable(u64 data_start);
+
+	RFILE* m_src = nullptr;
+	ZSTD_DCtx* m_dctx = nullptr;
+	ZSTD_DDict* m_ddict = nullptr;
+
+	/// Frame start positions, with one extra entry for the end of the last frame
+	std::vector<u64> m_compressedOffsets;
+	std::vector<u64> m_uncompressedOffsets;
+
+	std::unique_ptr<u8[]> m_readBuffer;
+};
@@ -49,6 +49,8 @@ Comments) 1950 to 1952 in the files http://tools.ietf.org/html/rfc1950
       (Thanks to Mark Adler for suggesting the approach)
   - build_index(...) - added progress prints
   - CHUNK changed from 16k to 512k
+  - build_index_incremental(...) - resumable variant of build_index which hands each new access
+      point to a callback, so the index can be used while it's being built
  */
 
 /* Illustrate the use of Z_BLOCK, inflatePrime(), and inflateSetDictionary()
@@ -102,6 +104,8 @@ Comments) 1950 to 1952 in the files http://tools.ietf.org/html/rfc1950
 #include <string.h>
 #include <zlib.h>
 
+#include <atomic>
+
 #include "common/FileSystem.h"
 
 //#define SPAN (1048576L)  /* desired distance between access points */
@@ -332,6 +336,141 @@ build_index_error:
 	return ret;
 }
 
+/* Callback used by build_index_incremental() to publish a new access point. Returns
+   nonzero to keep scanning, or zero if the point couldn't be stored. */
+typedef int (*add_point_fn)(void* ctx, int bits, s64 in, s64 out, unsigned left, unsigned char* window);
+
+/* Same pass as build_index(), but access points are handed to add_point as they are found,
+   and the scan can resume from a previously found point (resume != NULL) instead of the
+   start of the stream. Resumed scans use raw inflate, so the gzip trailer isn't verified.
+   The scan stops early when *cancel becomes true. Returns Z_STREAM_END when the whole
+   stream was scanned (with *total_out set to the uncompressed size), Z_OK if cancelled,
+   or a negative zlib error. */
+static inline int build_index_incremental(RFILE* in, s64 span, const struct point* resume,
+	add_point_fn add_point, void* ctx, const std::atomic_bool* cancel, s64* total_out)
+{
+	int ret;
+	s64 totin, totout; /* our own total counters to avoid 4GB limit */
+	s64 last;          /* totout value of last access point */
+	z_stream strm;
+	unsigned char* input = (unsigned char*)malloc(CHUNK);
+	unsigned char* window = (unsigned char*)malloc(WINSIZE);
+	if (input == NULL || window == NULL)
+	{
+		free(input);
+		free(window);
+		return Z_MEM_ERROR;
+	}
+
+	strm.zalloc = Z_NULL;
+	strm.zfree = Z_NULL;
+	strm.opaque = Z_NULL;
+	strm.avail_in = 0;
+	strm.next_in = Z_NULL;
+	if (resume)
+	{
+		ret = inflateInit2(&strm, -15); /* raw inflate, positioned at the access point */
+		if (ret != Z_OK)
+			goto build_index_incremental_ret;
+
+		if (FileSystem::FSeek64(in, resume->in - (resume->bits ? 1 : 0), SEEK_SET) == -1)
+		{
+			ret = Z_ERRNO;
+			goto build_index_incremental_end;
+		}
+		if (resume->bits)
+		{
+			ret = rfgetc(in);
+			if (ret == -1)
+			{
+				ret = rferror(in) ? Z_ERRNO : Z_DATA_ERROR;
+				goto build_index_incremental_end;
+			}
+			inflatePrime(&strm, resume->bits, ret >> (8 - resume->bits));
+		}
+		inflateSetDictionary(&strm, resume->window, WINSIZE);
+		totin = resume->in;
+		totout = last = resume->out;
+	}
+	else
+	{
+		ret = inflateInit2(&strm, 47); /* automatic zlib or gzip decoding */
+		if (ret != Z_OK)
+			goto build_index_incremental_ret;
+
+		FileSystem::FSeek64(in, 0, SEEK_SET);
+		totin = totout = last = 0;
+	}
+
+	strm.avail_out = 0;
+	do
+	{
+		if (cancel->load(std::memory_order_relaxed))
+		{
+			ret = Z_OK;
+			goto build_index_incremental_end;
+		}
+
+		/* get some compressed data from input file */
+		strm.avail_in = rfread(input, 1, CHUNK, in);
+		if (rferror(in))
+		{
+			ret = Z_ERRNO;
+			goto build_index_incremental_end;
+		}
+		if (strm.avail_in == 0)
+		{
+			ret = Z_DATA_ERROR;
+			goto build_index_incremental_end;
+		}
+		strm.next_in = input;
+
+		/* process all of that, or until end of stream */
+		do
+		{
+			/* reset sliding window if necessary */
+			if (strm.avail_out == 0)
+			{
+				strm.avail_out = WINSIZE;
+				strm.next_out = window;
+			}
+
+			totin += strm.avail_in;
+			totout += strm.avail_out;
+			ret = inflate(&strm, Z_BLOCK); /* return at end of block */
+			totin -= strm.avail_in;
+			totout -= strm.avail_out;
+			if (ret == Z_NEED_DICT)
+				ret = Z_DATA_ERROR;
+			if (ret == Z_MEM_ERROR || ret == Z_DATA_ERROR)
+				goto build_index_incremental_end;
+			if (ret == Z_STREAM_END)
+				break;
+
+			/* see build_index() for the conditions on adding an access point */
+			if ((strm.data_type & 128) && !(strm.data_type & 64) &&
+				(totout == 0 || totout - last > span))
+			{
+				if (!add_point(ctx, strm.data_type & 7, totin, totout, strm.avail_out, window))
+				{
+					ret = Z_MEM_ERROR;
+					goto build_index_incremental_end;
+				}
+				last = totout;
+			}
+		} while (strm.avail_in != 0);
+	} while (ret != Z_STREAM_END);
+
+	*total_out = totout;
+
+build_index_incremental_end:
+	(void)inflateEnd(&strm);
+build_index_incremental_ret:
+	free(input);
+	free(window);
+	return ret;
+}
+
 typedef struct zstate
 {
 	s64 out_offset;
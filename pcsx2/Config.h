@@ -379,6 +379,13 @@ struct Pcsx2Config
 
 				bool    EnableEECache    : 1;
 				bool    EnableFastmem    : 1;
+				bool    EnableTieredCompilation : 1;
+				bool    EnableVUTieredCompilation : 1;
+				bool    EnableEELoopRegisterCarry : 1;
+				bool    EnableEELoopIdioms : 1;
+				bool    EnableVUAVX : 1;
+				bool    EnableBlockProfiler : 1;
+				bool    EnableVUProgramStats : 1;
 			};
 		};
 
@@ -469,7 +476,8 @@ struct Pcsx2Config
 					DisableShaderCache : 1,
 					DisableFramebufferFetch : 1,
 					DisableVertexShaderExpand : 1,
-					SkipDuplicateFrames : 1;
+					SkipDuplicateFrames : 1,
+					SWQueueStats : 1;
 
 				bool
 					GPUPaletteConversion : 1,
@@ -851,7 +859,13 @@ struct Pcsx2Config
 			     MultitapPort0_Enabled      : 1,
 			     MultitapPort1_Enabled      : 1,
 
-			     HostFs                     : 1;
+			     HostFs                     : 1,
+			     // Advises the host to back guest RAM, GS memory and JIT code with huge pages
+			     EnableHugePages            : 1,
+			     // Decompresses whole compressed disc images into RAM in the background
+			     CdvdPreload                : 1,
+			     // Logs every disc sector request to a trace file in the cache folder
+			     CdvdTrace                  : 1;
 
 			// uses automatic NTFS compression when creating new memory cards (Win32 only)
 		};
@@ -122,6 +122,7 @@ private:
 		u8* data;
 		u32 length;
 		u64 sector;
+		u64 queueTime;
 	};
 	SimpleQueue<WriteQueueEntry> writeQueue;
 
@@ -146,8 +147,25 @@ private:
 	//Max tranfer on 48bit is 65536*512 = 32MB
 	int readBufferLen;
 	u8* readBuffer = nullptr;
+	u64 readStartTime;
 	//Read Buffer
 
+	//IO Stats
+	struct IOStats
+	{
+		u64 count = 0;
+		u64 sectors = 0;
+		//Timer ticks, from the request being made to the data being read/written
+		u64 totalTime = 0;
+		u64 maxTime = 0;
+
+		void Add(u64 startTime, u64 sectorCount);
+		void Log(const char* name) const;
+	};
+	IOStats readStats;
+	IOStats writeStats;
+	//IO Stats
+
 	//PIO Buffer
 	int pioPtr;
 	int pioEnd;
@@ -220,6 +238,7 @@ private:
 	void IO_Thread();
 	void IO_Read();
 	bool IO_Write();
+	void IO_FlushWrites();
 	bool IO_SparseZero(u64 byteOffset, u64 byteSize);
 	void IO_SparseCacheUpdateLocation(u64 Offset);
 	void IO_SparseCacheLoad();
@@ -235,6 +235,11 @@ void ATA::Close()
 		ioRunning = false;
 	}
 
+	readStats.Log("reads");
+	writeStats.Log("writes");
+	readStats = {};
+	writeStats = {};
+
 	//verify queue
 	if (!writeQueue.IsQueueEmpty())
 	{
@@ -14,6 +14,7 @@
  */
 
 #include "common/FileSystem.h"
+#include "common/Timer.h"
 
 #include "ATA.h"
 #include "DEV9/DEV9.h"
@@ -49,7 +50,11 @@ void ATA::IO_Thread()
 
 		//Read or Write
 		if (ioType == 0)
+		{
+			//Queued writes may overlap the read
+			IO_FlushWrites();
 			IO_Read();
+		}
 		else if (ioType == 1)
 		{
 			if (!IO_Write())
@@ -84,6 +89,7 @@ void ATA::IO_Read()
 		Console.Error("DEV9: ATA: File read error");
 		abort();
 	}
+	readStats.Add(readStartTime, nsector);
 	{
 		std::lock_guard ioSignallock(ioMutex);
 		ioRead = false;
@@ -164,9 +170,16 @@ bool ATA::IO_Write()
 		}
 	}
 	delete[] entry.data;
+	writeStats.Add(entry.queueTime, entry.length / 512);
 	return true;
 }
 
+void ATA::IO_FlushWrites()
+{
+	while (IO_Write())
+		;
+}
+
 void ATA::IO_SparseCacheLoad()
 {
 	// Reads are bounds checked, but for the sectors read only.
@@ -334,10 +347,11 @@ void ATA::HDD_ReadAsync(void (ATA::*drqCMD)())
 	nsectorLeft = nsector;
 	if (readBufferLen < nsector * 512)
 	{
-		delete readBuffer;
+		delete[] readBuffer;
 		readBuffer = new u8[nsector * 512];
 		readBufferLen = nsector * 512;
 	}
+	readStartTime = Common::Timer::GetCurrentValue();
 	waitingCmd = drqCMD;
 
 	{
@@ -382,7 +396,10 @@ void ATA::HDD_ReadSync(void (ATA::*drqCMD)())
 		readBuffer = new u8[nsector * 512];
 		readBufferLen = nsector * 512;
 	}
+	readStartTime = Common::Timer::GetCurrentValue();
 
+	//Queued writes may overlap the read
+	IO_FlushWrites();
 	IO_Read();
 
 	if (ioWritePaused)
@@ -423,3 +440,23 @@ void ATA::HDD_SetErrorAtTransferEnd()
 		HDD_SetLBA(currSect);
 	}
 }
+
+void ATA::IOStats::Add(u64 startTime, u64 sectorCount)
+{
+	const u64 time = Common::Timer::GetCurrentValue() - startTime;
+	count++;
+	sectors += sectorCount;
+	totalTime += time;
+	maxTime = std::max(maxTime, time);
+}
+
+void ATA::IOStats::Log(const char* name) const
+{
+	if (count == 0)
+		return;
+
+	Console.WriteLn("DEV9: ATA: %llu %s (%llu sectors), average latency %.3f ms, max %.3f ms",
+		static_cast<unsigned long long>(count), name, static_cast<unsigned long long>(sectors),
+		Common::Timer::ConvertValueToSeconds(totalTime / count) * 1000.0,
+		Common::Timer::ConvertValueToSeconds(maxTime) * 1000.0);
+}
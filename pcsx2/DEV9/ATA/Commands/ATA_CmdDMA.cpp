@@ -13,6 +13,8 @@
  *  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "common/Timer.h"
+
 #include "DEV9/ATA/ATA.h"
 #include "DEV9/DEV9.h"
 
@@ -64,6 +66,7 @@ void ATA::PostCmdDMADataFromHost()
 	entry.data = currentWrite;
 	entry.length = currentWriteLength;
 	entry.sector = currentWriteSectors;
+	entry.queueTime = Common::Timer::GetCurrentValue();
 	writeQueue.Enqueue(entry);
 	currentWrite = nullptr;
 	currentWriteLength = 0;
@@ -153,8 +156,8 @@ void ATA::HDD_ReadDMA(bool isLBA48)
 		return;
 	}
 
-	//Do Sync Read
-	HDD_ReadSync(&ATA::DRQCmdDMADataToHost);
+	//Do Async Read, DMA starts once the IO thread has the data
+	HDD_ReadAsync(&ATA::DRQCmdDMADataToHost);
 }
 
 void ATA::HDD_WriteDMA(bool isLBA48)
@@ -367,6 +367,20 @@ void SymbolMap::AddLabel(const char* name, u32 address, int moduleIndex)
 	}
 }
 
+// Finds the closest label at or before address, for naming code in the middle of a function.
+bool SymbolMap::GetNearestLabel(u32 address, std::string* name, u32* offset) const
+{
+	std::lock_guard<std::recursive_mutex> guard(m_lock);
+	auto it = activeLabels.upper_bound(address);
+	if (it == activeLabels.begin())
+		return false;
+
+	--it;
+	*name = it->second.name;
+	*offset = address - it->first;
+	return true;
+}
+
 void SymbolMap::AddData(u32 address, u32 size, DataType type, int moduleIndex)
 {
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
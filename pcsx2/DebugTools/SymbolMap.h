@@ -68,6 +68,7 @@ public:
 	u32 GetFunctionSize(u32 startAddress) const;
 
 	void AddLabel(const char* name, u32 address, int moduleIndex = -1);
+	bool GetNearestLabel(u32 address, std::string* name, u32* offset) const;
 
 	void AddData(u32 address, u32 size, DataType type, int moduleIndex = -1);
 	u32 GetDataStart(u32 address) const;
@@ -415,7 +415,10 @@ void GSgifTransfer(const u8* mem, u32 size)
 #endif
 
 	if (g_gs_renderer)
+	{
 		g_gs_renderer->Transfer(mem, size);
+		g_gs_renderer->EndTransfer();
+	}
 }
 
 void GSvsync(u32 field, bool registers_written)
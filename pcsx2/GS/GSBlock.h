@@ -56,8 +56,18 @@ class GSBlock
 	}
 #endif
 
+	// Non-temporal stores bypass the cache, used for large uploads which won't be read back soon
+	template <bool nt, class V>
+	__forceinline static void StoreColumn(u8* RESTRICT dst, int i, const V& v)
+	{
+		if (nt)
+			V::storent(&reinterpret_cast<V*>(dst)[i], v);
+		else
+			reinterpret_cast<V*>(dst)[i] = v;
+	}
+
 public:
-	template <int i, int alignment, u32 mask>
+	template <int i, int alignment, u32 mask, bool nt = false>
 	__forceinline static void WriteColumn32(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
 		const u8* RESTRICT s0 = &src[srcpitch * 0];
@@ -70,10 +80,18 @@ public:
 
 		GSVector8i::sw64(v0, v1);
 
-		GSVector8i* d = reinterpret_cast<GSVector8i*>(dst);
+		if (nt && mask == 0xffffffff)
+		{
+			StoreColumn<true>(dst, i * 2 + 0, v0);
+			StoreColumn<true>(dst, i * 2 + 1, v1);
+		}
+		else
+		{
+			GSVector8i* d = reinterpret_cast<GSVector8i*>(dst);
 
-		d[i * 2 + 0] = d[i * 2 + 0].smartblend<mask>(v0);
-		d[i * 2 + 1] = d[i * 2 + 1].smartblend<mask>(v1);
+			d[i * 2 + 0] = d[i * 2 + 0].smartblend<mask>(v0);
+			d[i * 2 + 1] = d[i * 2 + 1].smartblend<mask>(v1);
+		}
 
 #else
 
@@ -109,17 +127,27 @@ public:
 
 #endif
 
-		GSVector4i* d = reinterpret_cast<GSVector4i*>(dst);
+		if (nt && mask == 0xffffffff)
+		{
+			StoreColumn<true>(dst, i * 4 + 0, v0);
+			StoreColumn<true>(dst, i * 4 + 1, v1);
+			StoreColumn<true>(dst, i * 4 + 2, v2);
+			StoreColumn<true>(dst, i * 4 + 3, v3);
+		}
+		else
+		{
+			GSVector4i* d = reinterpret_cast<GSVector4i*>(dst);
 
-		d[i * 4 + 0] = d[i * 4 + 0].smartblend<mask>(v0);
-		d[i * 4 + 1] = d[i * 4 + 1].smartblend<mask>(v1);
-		d[i * 4 + 2] = d[i * 4 + 2].smartblend<mask>(v2);
-		d[i * 4 + 3] = d[i * 4 + 3].smartblend<mask>(v3);
+			d[i * 4 + 0] = d[i * 4 + 0].smartblend<mask>(v0);
+			d[i * 4 + 1] = d[i * 4 + 1].smartblend<mask>(v1);
+			d[i * 4 + 2] = d[i * 4 + 2].smartblend<mask>(v2);
+			d[i * 4 + 3] = d[i * 4 + 3].smartblend<mask>(v3);
+		}
 
 #endif
 	}
 
-	template <int i, int alignment>
+	template <int i, int alignment, bool nt = false>
 	__forceinline static void WriteColumn16(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
 		const u8* RESTRICT s0 = &src[srcpitch * 0];
@@ -136,8 +164,8 @@ public:
 		v0 = v0.acbd();
 		v1 = v1.acbd();
 
-		((GSVector8i*)dst)[i * 2 + 0] = v0;
-		((GSVector8i*)dst)[i * 2 + 1] = v1;
+		StoreColumn<nt>(dst, i * 2 + 0, v0);
+		StoreColumn<nt>(dst, i * 2 + 1, v1);
 
 #else
 
@@ -174,15 +202,15 @@ public:
 
 #endif
 
-		((GSVector4i*)dst)[i * 4 + 0] = v0;
-		((GSVector4i*)dst)[i * 4 + 1] = v2;
-		((GSVector4i*)dst)[i * 4 + 2] = v1;
-		((GSVector4i*)dst)[i * 4 + 3] = v3;
+		StoreColumn<nt>(dst, i * 4 + 0, v0);
+		StoreColumn<nt>(dst, i * 4 + 1, v2);
+		StoreColumn<nt>(dst, i * 4 + 2, v1);
+		StoreColumn<nt>(dst, i * 4 + 3, v3);
 
 #endif
 	}
 
-	template <int i, int alignment>
+	template <int i, int alignment, bool nt = false>
 	__forceinline static void WriteColumn8(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
 		// TODO: read unaligned as WriteColumn32 does and try saving a few shuffles
@@ -202,13 +230,13 @@ public:
 
 		if ((i & 1) == 0)
 		{
-			((GSVector8i*)dst)[i * 2 + 0] = v2;
-			((GSVector8i*)dst)[i * 2 + 1] = v3;
+			StoreColumn<nt>(dst, i * 2 + 0, v2);
+			StoreColumn<nt>(dst, i * 2 + 1, v3);
 		}
 		else
 		{
-			((GSVector8i*)dst)[i * 2 + 0] = v3;
-			((GSVector8i*)dst)[i * 2 + 1] = v2;
+			StoreColumn<nt>(dst, i * 2 + 0, v3);
+			StoreColumn<nt>(dst, i * 2 + 1, v2);
 		}
 
 #else
@@ -233,15 +261,15 @@ public:
 		GSVector4i::sw16(v0, v1, v2, v3);
 		GSVector4i::sw64(v0, v1, v2, v3);
 
-		((GSVector4i*)dst)[i * 4 + 0] = v0;
-		((GSVector4i*)dst)[i * 4 + 1] = v2;
-		((GSVector4i*)dst)[i * 4 + 2] = v1;
-		((GSVector4i*)dst)[i * 4 + 3] = v3;
+		StoreColumn<nt>(dst, i * 4 + 0, v0);
+		StoreColumn<nt>(dst, i * 4 + 1, v2);
+		StoreColumn<nt>(dst, i * 4 + 2, v1);
+		StoreColumn<nt>(dst, i * 4 + 3, v3);
 
 #endif
 	}
 
-	template <int i, int alignment>
+	template <int i, int alignment, bool nt = false>
 	__forceinline static void WriteColumn4(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
 		// TODO: read unaligned as WriteColumn32 does and try saving a few shuffles
@@ -270,8 +298,8 @@ public:
 		GSVector8i::mix4(v0, v1);
 		GSVector8i::sw32(v0, v1);
 
-		((GSVector8i*)dst)[i * 2 + 0] = v0;
-		((GSVector8i*)dst)[i * 2 + 1] = v1;
+		StoreColumn<nt>(dst, i * 2 + 0, v0);
+		StoreColumn<nt>(dst, i * 2 + 1, v1);
 
 #else
 
@@ -296,10 +324,10 @@ public:
 		GSVector4i::sw8(v0, v2, v1, v3);
 		GSVector4i::sw64(v0, v2, v1, v3);
 
-		((GSVector4i*)dst)[i * 4 + 0] = v0;
-		((GSVector4i*)dst)[i * 4 + 1] = v1;
-		((GSVector4i*)dst)[i * 4 + 2] = v2;
-		((GSVector4i*)dst)[i * 4 + 3] = v3;
+		StoreColumn<nt>(dst, i * 4 + 0, v0);
+		StoreColumn<nt>(dst, i * 4 + 1, v1);
+		StoreColumn<nt>(dst, i * 4 + 2, v2);
+		StoreColumn<nt>(dst, i * 4 + 3, v3);
 
 #endif
 	}
@@ -356,52 +384,52 @@ public:
 		}
 	}
 
-	template <int alignment, u32 mask>
+	template <int alignment, u32 mask, bool nt = false>
 	static void WriteBlock32(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
-		WriteColumn32<0, alignment, mask>(dst, src, srcpitch);
+		WriteColumn32<0, alignment, mask, nt>(dst, src, srcpitch);
 		src += srcpitch * 2;
-		WriteColumn32<1, alignment, mask>(dst, src, srcpitch);
+		WriteColumn32<1, alignment, mask, nt>(dst, src, srcpitch);
 		src += srcpitch * 2;
-		WriteColumn32<2, alignment, mask>(dst, src, srcpitch);
+		WriteColumn32<2, alignment, mask, nt>(dst, src, srcpitch);
 		src += srcpitch * 2;
-		WriteColumn32<3, alignment, mask>(dst, src, srcpitch);
+		WriteColumn32<3, alignment, mask, nt>(dst, src, srcpitch);
 	}
 
-	template <int alignment>
+	template <int alignment, bool nt = false>
 	static void WriteBlock16(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
-		WriteColumn16<0, alignment>(dst, src, srcpitch);
+		WriteColumn16<0, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 2;
-		WriteColumn16<1, alignment>(dst, src, srcpitch);
+		WriteColumn16<1, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 2;
-		WriteColumn16<2, alignment>(dst, src, srcpitch);
+		WriteColumn16<2, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 2;
-		WriteColumn16<3, alignment>(dst, src, srcpitch);
+		WriteColumn16<3, alignment, nt>(dst, src, srcpitch);
 	}
 
-	template <int alignment>
+	template <int alignment, bool nt = false>
 	static void WriteBlock8(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
-		WriteColumn8<0, alignment>(dst, src, srcpitch);
+		WriteColumn8<0, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 4;
-		WriteColumn8<1, alignment>(dst, src, srcpitch);
+		WriteColumn8<1, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 4;
-		WriteColumn8<2, alignment>(dst, src, srcpitch);
+		WriteColumn8<2, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 4;
-		WriteColumn8<3, alignment>(dst, src, srcpitch);
+		WriteColumn8<3, alignment, nt>(dst, src, srcpitch);
 	}
 
-	template <int alignment>
+	template <int alignment, bool nt = false>
 	static void WriteBlock4(u8* RESTRICT dst, const u8* RESTRICT src, int srcpitch)
 	{
-		WriteColumn4<0, alignment>(dst, src, srcpitch);
+		WriteColumn4<0, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 4;
-		WriteColumn4<1, alignment>(dst, src, srcpitch);
+		WriteColumn4<1, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 4;
-		WriteColumn4<2, alignment>(dst, src, srcpitch);
+		WriteColumn4<2, alignment, nt>(dst, src, srcpitch);
 		src += srcpitch * 4;
-		WriteColumn4<3, alignment>(dst, src, srcpitch);
+		WriteColumn4<3, alignment, nt>(dst, src, srcpitch);
 	}
 
 	template <int i>
@@ -15,6 +15,8 @@
 
 #include <unordered_set>
 
+#include "common/Console.h"
+
 #include "GS.h"
 #include "GSLocalMemory.h"
 #include "GSExtra.h"
@@ -62,8 +64,21 @@ GSLocalMemory::GSLocalMemory()
 	: m_clut(this)
 {
 	m_vm8 = (u8*)GSAllocateWrappedMemory(m_vmsize, 4);
+
+	// Advise before clearing, so the first touch faults in huge pages. The four views are of one
+	// shared memory object, so they're backed by the same pages.
+	const bool huge_pages = EmuConfig.EnableHugePages;
+	if (huge_pages && !HostSys::AdviseHugePages(m_vm8, static_cast<size_t>(m_vmsize) * 4, true))
+		Console.Warning("(HugePages) GS local memory: huge pages unavailable for shared memory, using normal pages");
+
 	memset(m_vm8, 0, m_vmsize);
 
+	if (huge_pages)
+	{
+		Console.WriteLn("(HugePages) GS local memory: %zu of %d MB backed by huge pages",
+			HostSys::GetHugePageBackedSize(m_vm8, m_vmsize) / _1mb, m_vmsize / static_cast<int>(_1mb));
+	}
+
 	MULTI_ISA_SELECT(GSLocalMemoryPopulateFunctions)(*this);
 
 	for (psm_t& psm : GSLocalMemory::m_psm)
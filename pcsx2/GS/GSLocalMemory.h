@@ -472,6 +472,10 @@ public:
 
 	static constexpr int m_vmsize = 1024 * 1024 * 4;
 
+	/// Block-aligned uploads at least this large (in bytes) bypass the cache with non-temporal stores.
+	/// FMV frames and streamed textures are written once and not sampled until well after they'd be evicted.
+	static constexpr int m_nt_upload_threshold = 64 * 1024;
+
 	u8* m_vm8;
 
 	GSClut m_clut;
@@ -25,9 +25,12 @@ class CURRENT_ISA::GSLocalMemoryFunctions
 	template <int psm, int bsx, int bsy, int alignment>
 	static void WriteImageColumn(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
-	template <int psm, int bsx, int bsy, int alignment>
+	template <int psm, int bsx, int bsy, int alignment, bool nt>
 	static void WriteImageBlock(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
+	template <int psm, int bsx, int bsy, int trbpp, bool nt>
+	static void WriteImageBlocks(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
 	template <int psm, int bsx, int bsy>
 	static void WriteImageLeftRight(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
@@ -250,7 +253,7 @@ void GSLocalMemoryFunctions::WriteImageColumn(GSLocalMemory& mem, int l, int r,
 	}
 }
 
-template <int psm, int bsx, int bsy, int alignment>
+template <int psm, int bsx, int bsy, int alignment, bool nt>
 void GSLocalMemoryFunctions::WriteImageBlock(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
 	u32 bp = BITBLTBUF.DBP;
@@ -262,14 +265,14 @@ void GSLocalMemoryFunctions::WriteImageBlock(GSLocalMemory& mem, int l, int r, i
 		{
 			switch (psm)
 			{
-				case PSMCT32: GSBlock::WriteBlock32<alignment, 0xffffffff>(mem.BlockPtr32(x, y, bp, bw), &src[x * 4], srcpitch); break;
-				case PSMCT16: GSBlock::WriteBlock16<alignment>(mem.BlockPtr16(x, y, bp, bw), &src[x * 2], srcpitch); break;
-				case PSMCT16S: GSBlock::WriteBlock16<alignment>(mem.BlockPtr16S(x, y, bp, bw), &src[x * 2], srcpitch); break;
-				case PSMT8: GSBlock::WriteBlock8<alignment>(mem.BlockPtr8(x, y, bp, bw), &src[x], srcpitch); break;
-				case PSMT4: GSBlock::WriteBlock4<alignment>(mem.BlockPtr4(x, y, bp, bw), &src[x >> 1], srcpitch); break;
-				case PSMZ32: GSBlock::WriteBlock32<alignment, 0xffffffff>(mem.BlockPtr32Z(x, y, bp, bw), &src[x * 4], srcpitch); break;
-				case PSMZ16: GSBlock::WriteBlock16<alignment>(mem.BlockPtr16Z(x, y, bp, bw), &src[x * 2], srcpitch); break;
-				case PSMZ16S: GSBlock::WriteBlock16<alignment>(mem.BlockPtr16SZ(x, y, bp, bw), &src[x * 2], srcpitch); break;
+				case PSMCT32: GSBlock::WriteBlock32<alignment, 0xffffffff, nt>(mem.BlockPtr32(x, y, bp, bw), &src[x * 4], srcpitch); break;
+				case PSMCT16: GSBlock::WriteBlock16<alignment, nt>(mem.BlockPtr16(x, y, bp, bw), &src[x * 2], srcpitch); break;
+				case PSMCT16S: GSBlock::WriteBlock16<alignment, nt>(mem.BlockPtr16S(x, y, bp, bw), &src[x * 2], srcpitch); break;
+				case PSMT8: GSBlock::WriteBlock8<alignment, nt>(mem.BlockPtr8(x, y, bp, bw), &src[x], srcpitch); break;
+				case PSMT4: GSBlock::WriteBlock4<alignment, nt>(mem.BlockPtr4(x, y, bp, bw), &src[x >> 1], srcpitch); break;
+				case PSMZ32: GSBlock::WriteBlock32<alignment, 0xffffffff, nt>(mem.BlockPtr32Z(x, y, bp, bw), &src[x * 4], srcpitch); break;
+				case PSMZ16: GSBlock::WriteBlock16<alignment, nt>(mem.BlockPtr16Z(x, y, bp, bw), &src[x * 2], srcpitch); break;
+				case PSMZ16S: GSBlock::WriteBlock16<alignment, nt>(mem.BlockPtr16SZ(x, y, bp, bw), &src[x * 2], srcpitch); break;
 				// TODO
 				default: __assume(0);
 			}
@@ -277,6 +280,29 @@ void GSLocalMemoryFunctions::WriteImageBlock(GSLocalMemory& mem, int l, int r, i
 	}
 }
 
+template <int psm, int bsx, int bsy, int trbpp, bool nt>
+void GSLocalMemoryFunctions::WriteImageBlocks(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
+{
+#if FAST_UNALIGNED
+	WriteImageBlock<psm, bsx, bsy, 0, nt>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+#else
+	size_t addr = (size_t)&src[l * trbpp >> 3];
+
+	if ((addr & 31) == 0 && (srcpitch & 31) == 0)
+	{
+		WriteImageBlock<psm, bsx, bsy, 32, nt>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+	else if ((addr & 15) == 0 && (srcpitch & 15) == 0)
+	{
+		WriteImageBlock<psm, bsx, bsy, 16, nt>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+	else
+	{
+		WriteImageBlock<psm, bsx, bsy, 0, nt>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+#endif
+}
+
 template <int psm, int bsx, int bsy>
 void GSLocalMemoryFunctions::WriteImageLeftRight(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
@@ -561,24 +587,17 @@ void GSLocalMemoryFunctions::WriteImage(GSLocalMemory& mem, int& tx, int& ty, co
 
 				if (h2 > 0)
 				{
-#if FAST_UNALIGNED
-					WriteImageBlock<psm, bsx, bsy, 0>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
-#else
-					size_t addr = (size_t)&s[la * trbpp >> 3];
-
-					if ((addr & 31) == 0 && (srcpitch & 31) == 0)
-					{
-						WriteImageBlock<psm, bsx, bsy, 32>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
-					}
-					else if ((addr & 15) == 0 && (srcpitch & 15) == 0)
+					if ((ra - la) * h2 * trbpp >= GSLocalMemory::m_nt_upload_threshold * 8)
 					{
-						WriteImageBlock<psm, bsx, bsy, 16>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlocks<psm, bsx, bsy, trbpp, true>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+
+						// non-temporal stores are weakly ordered, make them visible before the rasterizer threads read the memory
+						_mm_sfence();
 					}
 					else
 					{
-						WriteImageBlock<psm, bsx, bsy, 0>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlocks<psm, bsx, bsy, trbpp, false>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
-#endif
 
 					s += srcpitch * h2;
 					ty += h2;
@@ -55,6 +55,8 @@ public:
 	void PurgePool();
 
 	virtual void VSync(u32 field, bool registers_written, bool idle_frame);
+	/// Called once a GS packet has been fully processed, renderers may hand off batched work here.
+	virtual void EndTransfer() {}
 	virtual bool CanUpscale() { return false; }
 	virtual float GetUpscaleMultiplier() { return 1.0f; }
 	virtual float GetTextureScaleFactor() { return 1.0f; }
@@ -19,6 +19,8 @@
 #include "GSDrawScanline.h"
 #include "GS/GSExtra.h"
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
+#include "common/StringUtil.h"
 #include "VMManager.h"
 
 MULTI_ISA_UNSHARED_IMPL;
@@ -1110,6 +1112,10 @@ void GSSingleRasterizer::Draw(GSRasterizerData& data)
 	m_r.Draw(data);
 }
 
+void GSSingleRasterizer::Submit()
+{
+}
+
 void GSSingleRasterizer::Sync()
 {
 }
@@ -1137,6 +1143,16 @@ GSRasterizerList::GSRasterizerList(int threads)
 
 GSRasterizerList::~GSRasterizerList()
 {
+	// Debug only, for tuning the batch size and spin budget.
+	for (size_t i = 0; GSConfig.SWQueueStats && i < m_workers.size(); i++)
+	{
+		const auto& histogram = m_workers[i]->GetDepthHistogram();
+		std::string str;
+		for (u32 bucket = 0; bucket < GSWorker::DEPTH_HISTOGRAM_BUCKETS; bucket++)
+			str += StringUtil::StdStringFromFormat(" %llu", static_cast<unsigned long long>(histogram[bucket]));
+		Console.WriteLn("GS worker %zu queue depth histogram:%s", i, str.c_str());
+	}
+
 	_aligned_free(m_scanline);
 }
 
@@ -1177,12 +1193,31 @@ void GSRasterizerList::Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data
 
 	while (top < bottom)
 	{
-		m_workers[m_scanline[top++]]->Push(data);
+		GSWorker* worker = m_workers[m_scanline[top++]].get();
+
+		// Don't hold back work from a thread which has nothing else to do
+		if (worker->IsEmpty())
+			worker->Push(data);
+		else
+			worker->Stage(data);
 	}
+
+	if (++m_staged_draws >= SUBMIT_BATCH_SIZE)
+		Submit();
+}
+
+void GSRasterizerList::Submit()
+{
+	for (size_t i = 0; i < m_workers.size(); i++)
+		m_workers[i]->Submit();
+
+	m_staged_draws = 0;
 }
 
 void GSRasterizerList::Sync()
 {
+	m_staged_draws = 0;
+
 	if (!IsSynced())
 	{
 		for (size_t i = 0; i < m_workers.size(); i++)
@@ -17,8 +17,10 @@
 
 #include "common/boost_spsc_queue.hpp"
 #include "common/General.h"
+#include "common/MathUtils.h"
 #include "common/Threading.h"
 
+#include <array>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -33,6 +35,10 @@
 template <class T, int CAPACITY>
 class GSJobQueue final
 {
+public:
+	/// Buckets of the queue depth histogram, power of two ranges (0, 1, 2-3, 4-7, ...)
+	static constexpr u32 DEPTH_HISTOGRAM_BUCKETS = 16;
+
 private:
 	std::thread m_thread;
 	std::function<void()> m_startup;
@@ -43,6 +49,9 @@ private:
 
 	Threading::WorkSema m_sema;
 
+	// Only touched by the producer thread
+	std::array<u64, DEPTH_HISTOGRAM_BUCKETS> m_depth_histogram = {};
+
 	void ThreadProc()
 	{
 		if (m_startup)
@@ -50,7 +59,7 @@ private:
 
 		for (;;)
 		{
-			m_sema.WaitForWork();
+			m_sema.WaitForWorkWithSpin();
 			if (m_exit)
 				break;
 			while (m_queue.consume_one(*this))
@@ -80,21 +89,50 @@ public:
 
 	bool IsEmpty()
 	{
-		return m_queue.empty();
+		return m_queue.empty() && m_queue.staged() == 0;
 	}
 
-	void Push(const T& item)
+	/// Adds an item without waking the worker, call Submit() to hand over everything staged
+	void Stage(const T& item)
 	{
-		while (!m_queue.push(item))
+		while (!m_queue.stage(item))
+		{
+			Submit();
 			std::this_thread::yield();
+		}
+	}
+
+	/// Publishes all staged items with a single release store and at most one wake
+	void Submit()
+	{
+		const size_t staged = m_queue.staged();
+		if (staged == 0)
+			return;
+
+		const size_t depth = m_queue.size() + staged;
+		m_depth_histogram[std::min<u32>(depth ? (32 - count_leading_zero(static_cast<s32>(depth))) : 0, DEPTH_HISTOGRAM_BUCKETS - 1)]++;
+
+		m_queue.publish();
 		m_sema.NotifyOfWork();
 	}
 
+	void Push(const T& item)
+	{
+		Stage(item);
+		Submit();
+	}
+
 	void Wait()
 	{
+		Submit();
 		m_sema.WaitForEmpty();
 	}
 
+	const std::array<u64, DEPTH_HISTOGRAM_BUCKETS>& GetDepthHistogram() const
+	{
+		return m_depth_histogram;
+	}
+
 	void operator()(T& item)
 	{
 		m_func(item);
@@ -210,6 +248,7 @@ public:
 	virtual ~IRasterizer() {}
 
 	virtual void Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data) = 0;
+	virtual void Submit() = 0;
 	virtual void Sync() = 0;
 	virtual bool IsSynced() const = 0;
 	virtual int GetPixels(bool reset = true) = 0;
@@ -222,6 +261,7 @@ public:
 	~GSSingleRasterizer() override;
 
 	void Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data) override;
+	void Submit() override;
 	void Sync() override;
 	bool IsSynced() const override;
 	int GetPixels(bool reset = true) override;
@@ -245,6 +285,10 @@ protected:
 	std::vector<std::unique_ptr<GSWorker>> m_workers;
 	u8* m_scanline;
 	int m_thread_height;
+	int m_staged_draws = 0;
+
+	// Draws are handed to the workers in batches, so a frame of many small draws doesn't wake them for each one
+	static constexpr int SUBMIT_BATCH_SIZE = 32;
 
 	GSRasterizerList(int threads);
 
@@ -259,6 +303,7 @@ public:
 	// IRasterizer
 
 	void Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data) override;
+	void Submit() override;
 	void Sync() override;
 	bool IsSynced() const override;
 	int GetPixels(bool reset) override;
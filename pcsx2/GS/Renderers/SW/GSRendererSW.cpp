@@ -397,6 +397,11 @@ void GSRendererSW::Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item)
 	}
 }
 
+void GSRendererSW::EndTransfer()
+{
+	m_rl->Submit();
+}
+
 void GSRendererSW::Sync(int reason)
 {
 	m_rl->Sync();
@@ -13,11 +13,15 @@
  *  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <fstream>
+#include <mutex>
 #include <optional>
 
 #include <fmt/format.h>
+#include <zlib.h>
 
 #include "ryml_std.hpp"
 #include "ryml.hpp"
@@ -43,13 +47,48 @@ namespace GameDatabase
 {
 	static void parseAndInsert(const char *serial, const c4::yml::NodeRef& node);
 	static void initDatabase();
+	static bool loadBinaryCache(u32 source_size, u32 source_crc);
+	static void writeBinaryCache(u32 source_size, u32 source_crc);
+	static u32 getCacheSchemaHash();
+	static bool decodeEntry(u32 offset, GameDatabaseSchema::GameEntry* entry);
 } // namespace GameDatabase
 
 static constexpr char GAMEDB_YAML_FILE_NAME[] = "GameIndex.yaml";
+static constexpr char GAMEDB_CACHE_FILE_NAME[] = "GameIndex.bin";
+
+// Compiled form of the YAML, written to the cache folder the first time a given GameIndex.yaml is seen.
+//   header, index[count] sorted by serial, records, string pool
+// Records reference strings in the pool by (offset, length), identical strings are stored once.
+static constexpr char GAMEDB_CACHE_MAGIC[8] = {'P', 'C', 'S', 'X', '2', 'G', 'D', 'B'};
+static constexpr u32 GAMEDB_CACHE_VERSION = 2;
+
+struct GameDatabaseCacheHeader
+{
+	char magic[8];
+	u32 version;
+	u32 source_size;
+	u32 source_crc;
+	u32 schema_hash;
+	u32 count;
+	u32 records_offset;
+	u32 strings_offset;
+};
+
+struct GameDatabaseCacheIndexEntry
+{
+	u32 serial_offset;
+	u32 serial_length;
+	u32 record_offset;
+};
 
 static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> s_game_db;
 static std::once_flag s_load_once_flag;
 
+// When the cache was loaded, s_game_db only holds entries which have been looked up so far.
+static std::vector<u8> s_game_db_cache;
+static u32 s_game_db_count = 0;
+static std::mutex s_game_db_mutex;
+
 std::string GameDatabaseSchema::GameEntry::memcardFiltersAsString() const
 {
 	return fmt::to_string(fmt::join(memcardFilters, "/"));
@@ -867,6 +906,19 @@ u32 GameDatabaseSchema::GameEntry::applyGSHardwareFixes(Pcsx2Config::GSOptions&
 
 void GameDatabase::initDatabase()
 {
+	auto buf = Host::ReadResourceFileToString(GAMEDB_YAML_FILE_NAME);
+	if (!buf.has_value())
+	{
+		Console.Error("[GameDB] Unable to open GameDB file, file does not exist.");
+		return;
+	}
+
+	// Hashing the YAML is much cheaper than parsing it, and picks up user edits to it.
+	const u32 source_size = static_cast<u32>(buf->size());
+	const u32 source_crc = static_cast<u32>(crc32(0, reinterpret_cast<const Bytef*>(buf->data()), static_cast<uInt>(buf->size())));
+	if (loadBinaryCache(source_size, source_crc))
+		return;
+
 	ryml::Callbacks rymlCallbacks = ryml::get_callbacks();
 	rymlCallbacks.m_error = [](const char* msg, size_t msg_len, ryml::Location loc, void*) {
 		Console.Error("[YAML] Parsing error at {%s}:{%s} (bufpos={%s}): {%s}",
@@ -877,12 +929,6 @@ void GameDatabase::initDatabase()
 		Console.Error("[YAML] Internal Parsing error: {%s}",
 			msg);
 	});
-	auto buf = Host::ReadResourceFileToString(GAMEDB_YAML_FILE_NAME);
-	if (!buf.has_value())
-	{
-		Console.Error("[GameDB] Unable to open GameDB file, file does not exist.");
-		return;
-	}
 
 	ryml::Tree tree = ryml::parse_in_arena(c4::to_csubstr(buf.value()));
 	ryml::NodeRef root = tree.rootref();
@@ -905,6 +951,291 @@ void GameDatabase::initDatabase()
 	}
 
 	ryml::reset_callbacks();
+
+	s_game_db_count = static_cast<u32>(s_game_db.size());
+	writeBinaryCache(source_size, source_crc);
+}
+
+bool GameDatabase::loadBinaryCache(u32 source_size, u32 source_crc)
+{
+	if (EmuFolders::Cache.empty())
+		return false;
+
+	const std::string path(Path::Combine(EmuFolders::Cache, GAMEDB_CACHE_FILE_NAME));
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(path.c_str());
+	if (!data.has_value() || data->size() < sizeof(GameDatabaseCacheHeader))
+		return false;
+
+	GameDatabaseCacheHeader header;
+	std::memcpy(&header, data->data(), sizeof(header));
+	if (std::memcmp(header.magic, GAMEDB_CACHE_MAGIC, sizeof(header.magic)) != 0 || header.version != GAMEDB_CACHE_VERSION ||
+		header.source_size != source_size || header.source_crc != source_crc || header.schema_hash != getCacheSchemaHash())
+	{
+		Console.WriteLn("[GameDB] Cache is out of date, rebuilding from YAML.");
+		return false;
+	}
+
+	const u64 index_end = sizeof(header) + static_cast<u64>(header.count) * sizeof(GameDatabaseCacheIndexEntry);
+	if (index_end > header.records_offset || header.records_offset > header.strings_offset || header.strings_offset > data->size())
+	{
+		Console.Error("[GameDB] Cache is corrupted, rebuilding from YAML.");
+		return false;
+	}
+
+	s_game_db_cache = std::move(data.value());
+	s_game_db_count = header.count;
+	return true;
+}
+
+// Records store enum values as numbers, so a build which adds, removes or reorders any of them can't use
+// a cache written by another build, even when the YAML is the same.
+u32 GameDatabase::getCacheSchemaHash()
+{
+	uLong crc = crc32(0, nullptr, 0);
+	const auto add_name = [&crc](const char* name) {
+		// Include the terminator, so moving a character between neighbouring names changes the hash.
+		crc = crc32(crc, reinterpret_cast<const Bytef*>(name), static_cast<uInt>(std::strlen(name) + 1));
+	};
+	const auto add_count = [&crc](u32 count) {
+		crc = crc32(crc, reinterpret_cast<const Bytef*>(&count), sizeof(count));
+	};
+
+	add_count(static_cast<u32>(FPRoundMode::MaxCount));
+	for (const char* name : s_round_modes)
+		add_name(name);
+
+	add_count(static_cast<u32>(GameDatabaseSchema::ClampMode::Count));
+
+	add_count(GamefixId_COUNT);
+	for (u32 i = 0; i < GamefixId_COUNT; i++)
+		add_name(EnumToString(static_cast<GamefixId>(i)));
+
+	add_count(static_cast<u32>(SpeedHack::MaxCount));
+	for (u32 i = 0; i < static_cast<u32>(SpeedHack::MaxCount); i++)
+		add_name(Pcsx2Config::SpeedhackOptions::GetSpeedHackName(static_cast<SpeedHack>(i)));
+
+	add_count(static_cast<u32>(std::size(s_gs_hw_fix_names)));
+	for (const char* name : s_gs_hw_fix_names)
+		add_name(name);
+
+	return static_cast<u32>(crc);
+}
+
+void GameDatabase::writeBinaryCache(u32 source_size, u32 source_crc)
+{
+	if (EmuFolders::Cache.empty())
+		return;
+
+	std::vector<const std::pair<const std::string, GameDatabaseSchema::GameEntry>*> sorted;
+	sorted.reserve(s_game_db.size());
+	for (const auto& it : s_game_db)
+		sorted.push_back(&it);
+	std::sort(sorted.begin(), sorted.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+	std::vector<u8> records;
+	std::vector<u8> strings;
+	std::unordered_map<std::string_view, std::pair<u32, u32>> interned;
+
+	const auto put_u32 = [&records](u32 value) {
+		const size_t pos = records.size();
+		records.resize(pos + sizeof(value));
+		std::memcpy(&records[pos], &value, sizeof(value));
+	};
+	const auto intern = [&strings, &interned](const std::string& str) {
+		const auto it = interned.find(str);
+		if (it != interned.end())
+			return it->second;
+
+		const std::pair<u32, u32> ref(static_cast<u32>(strings.size()), static_cast<u32>(str.size()));
+		strings.insert(strings.end(), str.begin(), str.end());
+		interned.emplace(str, ref);
+		return ref;
+	};
+	const auto put_string = [&](const std::string& str) {
+		const auto [offset, length] = intern(str);
+		put_u32(offset);
+		put_u32(length);
+	};
+	const auto put_patch_entries = [&](const std::vector<DynamicPatchEntry>& entries) {
+		put_u32(static_cast<u32>(entries.size()));
+		for (const DynamicPatchEntry& entry : entries)
+		{
+			put_u32(entry.offset);
+			put_u32(entry.value);
+		}
+	};
+
+	std::vector<GameDatabaseCacheIndexEntry> index;
+	index.reserve(sorted.size());
+	for (const auto* it : sorted)
+	{
+		const GameDatabaseSchema::GameEntry& entry = it->second;
+		const auto [serial_offset, serial_length] = intern(it->first);
+		index.push_back({serial_offset, serial_length, static_cast<u32>(records.size())});
+
+		put_string(entry.name);
+		put_string(entry.region);
+		put_u32(static_cast<u32>(entry.eeRoundMode));
+		put_u32(static_cast<u32>(entry.eeDivRoundMode));
+		put_u32(static_cast<u32>(entry.vu0RoundMode));
+		put_u32(static_cast<u32>(entry.vu1RoundMode));
+		put_u32(static_cast<u32>(entry.eeClampMode));
+		put_u32(static_cast<u32>(entry.vu0ClampMode));
+		put_u32(static_cast<u32>(entry.vu1ClampMode));
+
+		put_u32(static_cast<u32>(entry.gameFixes.size()));
+		for (const GamefixId id : entry.gameFixes)
+			put_u32(static_cast<u32>(id));
+
+		put_u32(static_cast<u32>(entry.speedHacks.size()));
+		for (const auto& [id, value] : entry.speedHacks)
+		{
+			put_u32(static_cast<u32>(id));
+			put_u32(static_cast<u32>(value));
+		}
+
+		put_u32(static_cast<u32>(entry.gsHWFixes.size()));
+		for (const auto& [id, value] : entry.gsHWFixes)
+		{
+			put_u32(static_cast<u32>(id));
+			put_u32(static_cast<u32>(value));
+		}
+
+		put_u32(static_cast<u32>(entry.memcardFilters.size()));
+		for (const std::string& filter : entry.memcardFilters)
+			put_string(filter);
+
+		put_u32(static_cast<u32>(entry.patches.size()));
+		for (const auto& [crc, patch] : entry.patches)
+		{
+			put_u32(crc);
+			put_string(patch);
+		}
+
+		put_u32(static_cast<u32>(entry.dynaPatches.size()));
+		for (const DynamicPatch& patch : entry.dynaPatches)
+		{
+			put_patch_entries(patch.pattern);
+			put_patch_entries(patch.replacement);
+		}
+	}
+
+	GameDatabaseCacheHeader header = {};
+	std::memcpy(header.magic, GAMEDB_CACHE_MAGIC, sizeof(header.magic));
+	header.version = GAMEDB_CACHE_VERSION;
+	header.source_size = source_size;
+	header.source_crc = source_crc;
+	header.schema_hash = getCacheSchemaHash();
+	header.count = static_cast<u32>(index.size());
+	header.records_offset = static_cast<u32>(sizeof(header) + index.size() * sizeof(GameDatabaseCacheIndexEntry));
+	header.strings_offset = header.records_offset + static_cast<u32>(records.size());
+
+	std::vector<u8> data(header.strings_offset + strings.size());
+	std::memcpy(data.data(), &header, sizeof(header));
+	std::memcpy(data.data() + sizeof(header), index.data(), index.size() * sizeof(GameDatabaseCacheIndexEntry));
+	std::memcpy(data.data() + header.records_offset, records.data(), records.size());
+	std::memcpy(data.data() + header.strings_offset, strings.data(), strings.size());
+
+	const std::string path(Path::Combine(EmuFolders::Cache, GAMEDB_CACHE_FILE_NAME));
+	if (!FileSystem::WriteBinaryFile(path.c_str(), data.data(), data.size()))
+		Console.Warning("[GameDB] Failed to write cache to '%s'.", path.c_str());
+}
+
+bool GameDatabase::decodeEntry(u32 offset, GameDatabaseSchema::GameEntry* entry)
+{
+	GameDatabaseCacheHeader header;
+	std::memcpy(&header, s_game_db_cache.data(), sizeof(header));
+
+	const u8* const records_end = s_game_db_cache.data() + header.strings_offset;
+	const u8* ptr = s_game_db_cache.data() + header.records_offset + offset;
+	const char* const strings = reinterpret_cast<const char*>(records_end);
+	const size_t strings_size = s_game_db_cache.size() - header.strings_offset;
+	bool ok = true;
+
+	const auto get_u32 = [&]() -> u32 {
+		u32 value = 0;
+		if (ptr + sizeof(value) > records_end)
+		{
+			ok = false;
+			return 0;
+		}
+		std::memcpy(&value, ptr, sizeof(value));
+		ptr += sizeof(value);
+		return value;
+	};
+	const auto get_string = [&]() -> std::string {
+		const u32 str_offset = get_u32();
+		const u32 str_length = get_u32();
+		if (static_cast<u64>(str_offset) + str_length > strings_size)
+		{
+			ok = false;
+			return {};
+		}
+		return std::string(strings + str_offset, str_length);
+	};
+	// Counts are bounded by the remaining record bytes, so corruption can't make us allocate wildly.
+	const auto get_count = [&](u32 item_size) -> u32 {
+		const u32 count = get_u32();
+		if (static_cast<u64>(count) * item_size > static_cast<u64>(records_end - ptr))
+		{
+			ok = false;
+			return 0;
+		}
+		return count;
+	};
+	const auto get_patch_entries = [&](std::vector<DynamicPatchEntry>& entries) {
+		const u32 count = get_count(8);
+		entries.resize(count);
+		for (DynamicPatchEntry& patch_entry : entries)
+		{
+			patch_entry.offset = get_u32();
+			patch_entry.value = get_u32();
+		}
+	};
+
+	entry->name = get_string();
+	entry->region = get_string();
+	entry->eeRoundMode = static_cast<FPRoundMode>(get_u32());
+	entry->eeDivRoundMode = static_cast<FPRoundMode>(get_u32());
+	entry->vu0RoundMode = static_cast<FPRoundMode>(get_u32());
+	entry->vu1RoundMode = static_cast<FPRoundMode>(get_u32());
+	entry->eeClampMode = static_cast<GameDatabaseSchema::ClampMode>(static_cast<s32>(get_u32()));
+	entry->vu0ClampMode = static_cast<GameDatabaseSchema::ClampMode>(static_cast<s32>(get_u32()));
+	entry->vu1ClampMode = static_cast<GameDatabaseSchema::ClampMode>(static_cast<s32>(get_u32()));
+
+	for (u32 i = 0, count = get_count(4); i < count; i++)
+		entry->gameFixes.push_back(static_cast<GamefixId>(get_u32()));
+
+	for (u32 i = 0, count = get_count(8); i < count; i++)
+	{
+		const SpeedHack id = static_cast<SpeedHack>(get_u32());
+		entry->speedHacks.emplace_back(id, static_cast<int>(get_u32()));
+	}
+
+	for (u32 i = 0, count = get_count(8); i < count; i++)
+	{
+		const GameDatabaseSchema::GSHWFixId id = static_cast<GameDatabaseSchema::GSHWFixId>(get_u32());
+		entry->gsHWFixes.emplace_back(id, static_cast<s32>(get_u32()));
+	}
+
+	for (u32 i = 0, count = get_count(8); i < count; i++)
+		entry->memcardFilters.push_back(get_string());
+
+	for (u32 i = 0, count = get_count(12); i < count; i++)
+	{
+		const u32 crc = get_u32();
+		entry->patches.emplace(crc, get_string());
+	}
+
+	for (u32 i = 0, count = get_count(8); i < count; i++)
+	{
+		DynamicPatch patch;
+		get_patch_entries(patch.pattern);
+		get_patch_entries(patch.replacement);
+		entry->dynaPatches.push_back(std::move(patch));
+	}
+
+	return ok;
 }
 
 void GameDatabase::ensureLoaded()
@@ -912,7 +1243,7 @@ void GameDatabase::ensureLoaded()
 	std::call_once(s_load_once_flag, []() {
 		Console.WriteLn("[GameDB] Has not been initialized yet, initializing...");
 		initDatabase();
-		Console.WriteLn("[GameDB] %zu games on record", s_game_db.size());
+		Console.WriteLn("[GameDB] %u games on record", s_game_db_count);
 	});
 }
 
@@ -920,6 +1251,50 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 {
 	GameDatabase::ensureLoaded();
 
-	auto iter = s_game_db.find(StringUtil::toLower(serial));
-	return (iter != s_game_db.end()) ? &iter->second : nullptr;
+	const std::string key(StringUtil::toLower(serial));
+	std::unique_lock lock(s_game_db_mutex);
+
+	auto iter = s_game_db.find(key);
+	if (iter != s_game_db.end())
+		return &iter->second;
+	if (s_game_db_cache.empty())
+		return nullptr;
+
+	// Binary search the sorted index, then decode just that entry and keep it around.
+	const u8* base = s_game_db_cache.data() + sizeof(GameDatabaseCacheHeader);
+	GameDatabaseCacheHeader header;
+	std::memcpy(&header, s_game_db_cache.data(), sizeof(header));
+	const std::string_view strings(reinterpret_cast<const char*>(s_game_db_cache.data() + header.strings_offset),
+		s_game_db_cache.size() - header.strings_offset);
+
+	u32 lo = 0, hi = s_game_db_count;
+	while (lo < hi)
+	{
+		const u32 mid = lo + (hi - lo) / 2;
+		GameDatabaseCacheIndexEntry index_entry;
+		std::memcpy(&index_entry, base + mid * sizeof(GameDatabaseCacheIndexEntry), sizeof(index_entry));
+
+		const std::string_view mid_serial(strings.substr(index_entry.serial_offset, index_entry.serial_length));
+		const int cmp = mid_serial.compare(key);
+		if (cmp < 0)
+		{
+			lo = mid + 1;
+		}
+		else if (cmp > 0)
+		{
+			hi = mid;
+		}
+		else
+		{
+			GameDatabaseSchema::GameEntry entry;
+			if (!decodeEntry(index_entry.record_offset, &entry))
+			{
+				Console.Error("[GameDB] Cache entry for '%s' is corrupted.", key.c_str());
+				return nullptr;
+			}
+			return &s_game_db.emplace(key, std::move(entry)).first->second;
+		}
+	}
+
+	return nullptr;
 }
@@ -57,4 +57,7 @@ namespace Host
 
 	/// Reads a resource file file from the resources directory as a string.
 	std::optional<std::string> ReadResourceFileToString(const char* filename);
+
+	/// Shows a short message to the user, thread-safe. Duration is in seconds.
+	void AddOSDMessage(std::string message, float duration = 2.0f);
 } // namespace Host
@@ -16,10 +16,13 @@
 #include "Common.h"
 #include "R5900OpcodeTables.h"
 #include "Elfheader.h"
+#include "InterpreterBlockCache.h"
 
 #include "common/FastJmp.h"
 
+#include <array>
 #include <float.h>
+#include <utility>
 
 static int branch2 = 0;
 static u32 cpuBlockCycles = 0;		// 3 bit fixed point version of cycle count
@@ -29,6 +32,17 @@ static u32 intLastBranchTo;
 
 static void intEventTest(void);
 
+struct IntInst
+{
+	void (*interpret)();
+	u32 code;
+	u16 cycles;
+	u16 words;
+};
+
+using IntBlockCache = InterpreterBlockCache<IntInst, 32, 4096>;
+static IntBlockCache s_blocks;
+
 void intUpdateCPUCycles()
 {
 	const bool lowcycles = (cpuBlockCycles <= 40);
@@ -83,6 +97,152 @@ static void execI(void)
 	opcode.interpret();
 }
 
+// LUI followed by an ADDIU or ORI of the same register just loads a constant, so the pair is decoded
+// into a single instruction, with the constant in place of the code.
+template <u32 rt>
+static void intLoadConstant()
+{
+	cpuRegs.GPR.r[rt].SD[0] = static_cast<s32>(cpuRegs.code);
+}
+
+template <size_t... rt>
+static constexpr std::array<void (*)(), sizeof...(rt)> intMakeLoadConstants(std::index_sequence<rt...>)
+{
+	return {{&intLoadConstant<rt>...}};
+}
+
+static constexpr std::array<void (*)(), 32> s_load_constant = intMakeLoadConstants(std::make_index_sequence<32>());
+
+static bool intFuseLoadConstant(IntInst& inst, u32 next)
+{
+	const u32 rt = (inst.code >> 16) & 0x1F;
+	if ((inst.code >> 26) != 0x0F || rt == 0 || ((next >> 21) & 0x1F) != rt || ((next >> 16) & 0x1F) != rt)
+		return false;
+
+	const u32 upper = inst.code << 16;
+	if ((next >> 26) == 0x09) // ADDIU
+		inst.code = upper + static_cast<u32>(static_cast<s16>(next));
+	else if ((next >> 26) == 0x0D) // ORI
+		inst.code = upper | (next & 0xFFFF);
+	else
+		return false;
+
+	inst.interpret = s_load_constant[rt];
+	inst.cycles += R5900::GetInstruction(next).cycles;
+	inst.words++;
+	return true;
+}
+
+static IntBlockCache::Block* intDecodeBlock(u32 pc)
+{
+	using namespace vtlb_private;
+
+	// Only cache code which is mapped where PSM() says, as that's what page protection and Clear()
+	// calls use. Anything else, like code behind a remapped TLB entry or in the scratchpad, is
+	// interpreted one instruction at a time.
+	const u32 key = pc & 0x1fffffff;
+	const VTLBVirtual vmv = vtlbdata.vmap[pc >> VTLB_PAGE_BITS];
+	if (vmv.isHandler(pc))
+		return nullptr;
+
+	const u32* code = reinterpret_cast<const u32*>(vmv.assumePtr(pc));
+	if (code != PSM(key))
+		return nullptr;
+
+	// Blocks in RAM are invalidated through the same page protection as the recompiler's, except in
+	// the pages which have already faulted, which are checked every time the block runs instead.
+	bool checked = false;
+	switch (mmap_GetRamPageInfo(key))
+	{
+		case ProtMode_NotRequired:
+			break;
+
+		case ProtMode_Manual:
+			checked = true;
+			break;
+
+		default:
+			// The kernel keeps the thread contexts in these pages, see memory_protect_recompiled_code().
+			if ((pc >> 12) == 0x81 || (pc >> 12) == 0x80001)
+				checked = true;
+			else
+				mmap_MarkCountedRamPage(key);
+			break;
+	}
+
+	IntBlockCache::Block& block = s_blocks.Allocate(pc);
+	const u32 max_words = std::min((VTLB_PAGE_SIZE - (pc & VTLB_PAGE_MASK)) / 4, s_blocks.MAX_WORDS);
+	while (block.words < max_words)
+	{
+		const u32 op = code[block.words++];
+		const R5900::OPCODE& opcode = R5900::GetInstruction(op);
+
+		IntInst& inst = block.insts[block.count++];
+		inst.interpret = opcode.interpret;
+		inst.code = op;
+		inst.cycles = opcode.cycles;
+		inst.words = 1;
+
+		// The branch runs its delay slot itself.
+		if (opcode.flags & IS_BRANCH)
+			break;
+
+		// Checked blocks are only compared against RAM on entry, so a store which rewrites the
+		// rest of the block has to end it.
+		if (checked && (opcode.flags & IS_STORE))
+			break;
+
+		if (!checked && block.words < max_words && intFuseLoadConstant(inst, code[block.words]))
+			block.words++;
+	}
+
+	if (checked)
+		block.check_ptr = code;
+
+	s_blocks.Commit(block, pc, key);
+	return &block;
+}
+
+// Runs the decoded block at the pc, or a single instruction if the code there can't be cached.
+// Instructions run exactly as execI() would run them, but leave the block as soon as the pc goes
+// anywhere else, which covers taken branches and exceptions, or if the block gets invalidated.
+static void execBlock()
+{
+	// Fetches have to go through the emulated data cache, like execI()'s memRead32() does.
+	if (CHECK_CACHE)
+	{
+		execI();
+		return;
+	}
+
+	const u32 pc = cpuRegs.pc;
+	IntBlockCache::Block* block = s_blocks.Lookup(pc);
+	if (!block || (block->check_ptr && !block->IsCurrent()))
+	{
+		block = intDecodeBlock(pc);
+		if (!block)
+		{
+			execI();
+			return;
+		}
+	}
+
+	u32 next_pc = pc;
+	for (u32 i = 0; i < block->count; i++)
+	{
+		const IntInst& inst = block->insts[i];
+		next_pc += inst.words * 4;
+		cpuRegs.pc = next_pc;
+		cpuRegs.code = inst.code;
+		cpuBlockCycles += inst.cycles * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
+
+		inst.interpret();
+
+		if (cpuRegs.pc != next_pc || block->pc != pc)
+			break;
+	}
+}
+
 static __fi void _doBranch_shared(u32 tar)
 {
 	branch2 = cpuRegs.branch = 1;
@@ -154,6 +314,13 @@ void intSetBranch(void)
 	branch2 = 1;
 }
 
+void intInterpretBlock()
+{
+	branch2 = 0;
+	while (!branch2)
+		execI();
+}
+
 ////////////////////////////////////////////////////////////////////
 // R5900 Branching Instructions!
 // These are the interpreter versions of the branch instructions.  Unlike other
@@ -417,6 +584,9 @@ static void intReset()
 {
 	cpuRegs.branch = 0;
 	branch2 = 0;
+
+	s_blocks.Reset();
+	mmap_ResetBlockTracking();
 }
 
 static void intEventTest()
@@ -521,14 +691,21 @@ static void intExecute(void)
 
 		case GAME_RUNNING:
 			for (;;)
-				execI();
+				execBlock();
 			break;
 		}
 	}
 }
 
-static void intClear(u32 Addr, u32 Size) { }
-static void intShutdown(void) { }
+static void intClear(u32 Addr, u32 Size)
+{
+	s_blocks.Invalidate(Addr & 0x1fffffff, Size);
+}
+
+static void intShutdown(void)
+{
+	s_blocks.Shutdown();
+}
 
 R5900cpu intCpu =
 {
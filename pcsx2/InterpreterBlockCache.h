@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: LGPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <algorithm>
+#include <memory>
+
+/// Direct-mapped cache of pre-decoded blocks for the EE and IOP interpreters.
+///
+/// A block is a run of guest instructions up to and including the first branch, decoded once into
+/// handler pointers, so the interpreter doesn't fetch and walk the opcode tables for every
+/// instruction. Blocks are tagged with the pc they were decoded at, and keyed by the address the
+/// CPU provider's Clear() is called with for the same code (the pc with any mirroring removed).
+/// Both share their low bits, so they index the same slot.
+///
+/// Blocks never cross a 4KB page and hold at most MaxInsts words, so only the slots of the few
+/// addresses before a cleared range can hold a block overlapping it, and a count of blocks per page
+/// lets Clear() skip pages without code in a single lookup.
+template <typename Inst, u32 MaxInsts, u32 SlotCount>
+class InterpreterBlockCache
+{
+	static_assert((SlotCount & (SlotCount - 1)) == 0, "Slot count must be a power of two");
+
+public:
+	static constexpr u32 PAGE_SHIFT = 12;
+	static constexpr u32 PAGE_SIZE = 1u << PAGE_SHIFT;
+	static constexpr u32 MAX_WORDS = MaxInsts;
+
+	// Keys are physical addresses, which are 29 bits on both CPUs.
+	static constexpr u32 KEY_PAGES = 0x20000000u >> PAGE_SHIFT;
+
+	// Never word aligned, so it doesn't match any pc.
+	static constexpr u32 INVALID_PC = 1;
+
+	struct Block
+	{
+		u32 pc;
+		u32 key;
+
+		// Guest words covered, which is more than count when instructions have been fused.
+		u32 words;
+		u32 count;
+
+		// Guest code to compare against at every run, for pages which aren't write protected.
+		const u32* check_ptr;
+
+		Inst insts[MaxInsts];
+
+		/// Returns false if the guest code has changed since the block was decoded. Only usable on
+		/// blocks without fused instructions, which is how blocks with a check_ptr are decoded.
+		bool IsCurrent() const
+		{
+			for (u32 i = 0; i < count; i++)
+			{
+				if (check_ptr[i] != insts[i].code)
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	void Reset()
+	{
+		if (!m_blocks)
+		{
+			m_blocks = std::make_unique<Block[]>(SlotCount);
+			m_page_blocks = std::make_unique<u16[]>(KEY_PAGES);
+		}
+
+		for (u32 i = 0; i < SlotCount; i++)
+			m_blocks[i].pc = INVALID_PC;
+		std::fill_n(m_page_blocks.get(), KEY_PAGES, 0);
+	}
+
+	void Shutdown()
+	{
+		m_blocks.reset();
+		m_page_blocks.reset();
+	}
+
+	__fi Block* Lookup(u32 pc)
+	{
+		Block& block = m_blocks[(pc >> 2) & (SlotCount - 1)];
+		return (block.pc == pc) ? &block : nullptr;
+	}
+
+	/// Evicts the block in the slot for pc, and returns the slot to decode into. The block isn't
+	/// found by Lookup() until it's committed.
+	Block& Allocate(u32 pc)
+	{
+		Block& block = m_blocks[(pc >> 2) & (SlotCount - 1)];
+		if (block.pc != INVALID_PC)
+			Remove(block);
+
+		block.words = 0;
+		block.count = 0;
+		block.check_ptr = nullptr;
+		return block;
+	}
+
+	void Commit(Block& block, u32 pc, u32 key)
+	{
+		block.pc = pc;
+		block.key = key;
+		m_page_blocks[key >> PAGE_SHIFT]++;
+	}
+
+	/// Invalidates every block overlapping size words at key.
+	void Invalidate(u32 key, u32 size)
+	{
+		if (!m_blocks)
+			return;
+
+		const u32 start = key & ~3u;
+		const u32 end = std::min<u64>(static_cast<u64>(start) + std::max<u32>(size, 1) * 4, KEY_PAGES << PAGE_SHIFT);
+		for (u32 page = start >> PAGE_SHIFT; page < KEY_PAGES && (page << PAGE_SHIFT) < end; page++)
+		{
+			if (m_page_blocks[page] == 0)
+				continue;
+
+			const u32 page_start = page << PAGE_SHIFT;
+			const u32 first = std::max(page_start, std::max(start, (MaxInsts - 1) * 4) - (MaxInsts - 1) * 4);
+			const u32 last = std::min(end, page_start + PAGE_SIZE);
+			for (u32 addr = first; addr < last && m_page_blocks[page] != 0; addr += 4)
+			{
+				Block& block = m_blocks[(addr >> 2) & (SlotCount - 1)];
+				if (block.pc != INVALID_PC && block.key == addr && addr + block.words * 4 > start)
+					Remove(block);
+			}
+		}
+	}
+
+private:
+	void Remove(Block& block)
+	{
+		m_page_blocks[block.key >> PAGE_SHIFT]--;
+		block.pc = INVALID_PC;
+	}
+
+	std::unique_ptr<Block[]> m_blocks;
+	std::unique_ptr<u16[]> m_page_blocks;
+};
@@ -117,18 +117,70 @@ bool SysMainMemory::Allocate()
 void SysMainMemory::Reset()
 {
 	Console.WriteLn(Color_StrongBlue, "Resetting host memory for virtual systems...");
+
+	// Advise before the reset clears the memory, so the first touch faults in huge pages.
+	const bool advise_huge_pages = EmuConfig.EnableHugePages && !m_huge_pages_advised;
+	if (advise_huge_pages)
+		AdviseHugePages();
+
 	m_ee.Reset();
 	m_iop.Reset();
 	m_vu.Reset();
 
+	if (advise_huge_pages)
+		ReportHugePages();
+
 	// Note: newVif is reset as part of other VIF structures.
 	// Software is reset on the GS thread.
 }
 
+std::array<SysMainMemory::HugePageRegion, 4> SysMainMemory::GetHugePageRegions() const
+{
+	// Guest RAM is touched randomly by the EE/IOP/VU, and the JIT code is spread over the whole
+	// reserve, so both thrash the dTLB with 4K pages. Guest RAM lives in shared memory so fastmem
+	// can map views of it, the code reserve is anonymous.
+	u8* main_base = m_mainMemory->GetBase();
+	const bool main_shared = (m_mainMemory->GetFileHandle() != nullptr);
+	return {{
+		{"EE RAM", main_base + HostMemoryMap::EEmemOffset, HostMemoryMap::IOPmemOffset - HostMemoryMap::EEmemOffset, main_shared},
+		{"IOP RAM", main_base + HostMemoryMap::IOPmemOffset, HostMemoryMap::VUmemOffset - HostMemoryMap::IOPmemOffset, main_shared},
+		{"VU RAM", main_base + HostMemoryMap::VUmemOffset, HostMemoryMap::bumpAllocatorOffset - HostMemoryMap::VUmemOffset, main_shared},
+		{"Recompiler code", m_codeMemory->GetBase(), HostMemoryMap::CodeSize, (m_codeMemory->GetFileHandle() != nullptr)},
+	}};
+}
+
+void SysMainMemory::AdviseHugePages()
+{
+	for (const HugePageRegion& region : GetHugePageRegions())
+	{
+		if (!HostSys::AdviseHugePages(region.base, region.size, region.shared))
+		{
+			Console.Warning("(HugePages) %s: huge pages unavailable for %s memory, using normal pages", region.name,
+				region.shared ? "shared" : "anonymous");
+		}
+	}
+
+	m_huge_pages_advised = true;
+}
+
+void SysMainMemory::ReportHugePages() const
+{
+	// The advice succeeding doesn't mean the kernel used huge pages, so report what's actually mapped.
+	// The code reserve only fills up as blocks are compiled.
+	for (const HugePageRegion& region : GetHugePageRegions())
+	{
+		Console.WriteLn("(HugePages) %s: %zu of %zu MB backed by huge pages", region.name,
+			HostSys::GetHugePageBackedSize(region.base, region.size) / _1mb, region.size / _1mb);
+	}
+}
+
 void SysMainMemory::Release()
 {
 	Console.WriteLn(Color_Blue, "Releasing host memory for virtual systems...");
 
+	if (m_huge_pages_advised)
+		ReportHugePages();
+
 	vtlb_Core_Free(); // Just to be sure... (calling order could result in it getting missed during Decommit).
 
 	m_ee.Release();
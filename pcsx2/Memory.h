@@ -19,6 +19,8 @@
 #include "VirtualMemory.h"
 #include "vtlb.h"
 
+#include <array>
+
 #define PSM(mem)	(vtlb_GetPhyPtr((mem)&0x1fffffff)) //pcsx2 is a competition.The one with most hacks wins :D
 
 #define psHu8(mem)	(*(u8 *)&eeHw[(mem) & 0xffff])
@@ -119,6 +121,20 @@ protected:
 	iopMemoryReserve m_iop;
 	vuMemoryReserve m_vu;
 
+	bool m_huge_pages_advised = false;
+
+	struct HugePageRegion
+	{
+		const char* name;
+		u8* base;
+		size_t size;
+		bool shared;
+	};
+
+	std::array<HugePageRegion, 4> GetHugePageRegions() const;
+	void AdviseHugePages();
+	void ReportHugePages() const;
+
 public:
 	SysMainMemory();
 	~SysMainMemory();
@@ -14,7 +14,11 @@
  */
 
 #include <array>
+#include <chrono>
+#include <condition_variable>
 #include <cstring> /* memset */
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <file/file_path.h>
@@ -36,6 +40,8 @@
 
 #define MC2_ERASE_SIZE 8448 /* 528 * 16 */
 
+#define MCD_FLUSH_INTERVAL_MS 1000 /* Longest time a write stays in memory before reaching the card file */
+
 static bool FileMcd_Open = false;
 
 // ECC code ported from mymc
@@ -172,18 +178,32 @@ static bool ConvertRAWtoNoECC(const char* file_in, const char* file_out)
 // --------------------------------------------------------------------------------------
 //  FileMemoryCard
 // --------------------------------------------------------------------------------------
-// Provides thread-safe direct file IO mapping.
+// Keeps the card images in memory and writes modified erase blocks back to the files
+// from a background thread, so bursts of small saves don't turn into a syscall each.
 //
 class FileMemoryCard
 {
 protected:
 	RFILE* m_file[8] = {};
 	std::string m_filenames[8] = {};
-	std::vector<u8> m_currentdata;
 	u64 m_chksum[8] = {};
 	bool m_ispsx[8] = {};
 	u32 m_chkaddr = 0;
 
+	// Whole card file contents, and the offset of card address 0 within it.
+	std::vector<u8> m_data[8];
+	u32 m_dataoffset[8] = {};
+	// One bit per MC2_ERASE_SIZE bytes of m_data which haven't been written back yet.
+	std::vector<u64> m_dirty[8];
+	bool m_anydirty = false;
+
+	// Guards m_data and m_dirty. m_flush_mutex serializes flushes and is held during file IO.
+	std::mutex m_data_mutex;
+	std::mutex m_flush_mutex;
+	std::condition_variable m_flush_cv;
+	std::thread m_flush_thread;
+	bool m_flush_quit = false;
+
 public:
 	FileMemoryCard();
 	~FileMemoryCard();
@@ -193,6 +213,7 @@ public:
 
 	void Open();
 	void Close();
+	void Flush();
 
 	s32 IsPresent(uint slot);
 	void GetSizeInfo(uint slot, McdSizeInfo& outways);
@@ -203,8 +224,11 @@ public:
 	u64 GetCRC(uint slot);
 
 protected:
-	bool Seek(RFILE* f, u32 adr);
 	bool Create(const char* mcdFile, uint sizeInMB);
+	bool LoadData(uint slot);
+	u8* GetDataPtr(uint slot, u32 adr, int size);
+	void MarkDirty(uint slot, u32 adr, int size);
+	void FlushThread();
 };
 
 uint FileMcd_GetMtapPort(uint slot)
@@ -268,6 +292,8 @@ FileMemoryCard::~FileMemoryCard() = default;
 
 void FileMemoryCard::Open()
 {
+	bool any_open = false;
+
 	for (int slot = 0; slot < 8; ++slot)
 	{
 		m_filenames[slot] = {};
@@ -324,24 +350,47 @@ void FileMemoryCard::Open()
 		else
 			m_file[slot] = FileSystem::OpenFile(fname.c_str(), "r+b");
 
+		if (m_file[slot] && !LoadData(slot))
+		{
+			Console.Error("Error reading memcard: %s", fname.c_str());
+			rfclose(m_file[slot]);
+			m_file[slot] = nullptr;
+		}
+
 		if (m_file[slot]) // Load checksum
 		{
 			m_filenames[slot] = std::move(fname);
-			m_ispsx[slot] = FileSystem::FSize64(m_file[slot]) == 0x20000;
+			m_ispsx[slot] = m_data[slot].size() == 0x20000;
 			m_chkaddr = 0x210;
 
-			if (!m_ispsx[slot] && FileSystem::FSeek64(m_file[slot], m_chkaddr, SEEK_SET) == 0)
-			{
-				const size_t read_result = rfread(&m_chksum[slot], sizeof(m_chksum[slot]), 1, m_file[slot]);
-				if (read_result == 0)
-					Console.Error("Error reading memcard.");
-			}
+			if (!m_ispsx[slot])
+				std::memcpy(&m_chksum[slot], &m_data[slot][m_chkaddr], sizeof(m_chksum[slot]));
+
+			any_open = true;
 		}
 	}
+
+	if (any_open)
+	{
+		m_flush_quit = false;
+		m_flush_thread = std::thread([this]() { FlushThread(); });
+	}
 }
 
 void FileMemoryCard::Close()
 {
+	if (m_flush_thread.joinable())
+	{
+		{
+			std::unique_lock lock(m_data_mutex);
+			m_flush_quit = true;
+		}
+		m_flush_cv.notify_one();
+		m_flush_thread.join();
+	}
+
+	Flush();
+
 	for (int slot = 0; slot < 8; ++slot)
 	{
 		if (!m_file[slot])
@@ -353,6 +402,8 @@ void FileMemoryCard::Close()
 
 		rfclose(m_file[slot]);
 		m_file[slot] = nullptr;
+		m_data[slot] = {};
+		m_dirty[slot] = {};
 
 		if (StringUtil::EndsWith(m_filenames[slot], ".bin"))
 		{
@@ -365,22 +416,129 @@ void FileMemoryCard::Close()
 	}
 }
 
-// Returns FALSE if the seek failed (is outside the bounds of the file).
-bool FileMemoryCard::Seek(RFILE* f, u32 adr)
+bool FileMemoryCard::LoadData(uint slot)
 {
-	const s64 size = FileSystem::FSize64(f);
+	const s64 size = FileSystem::FSize64(m_file[slot]);
+	if (size <= 0 || FileSystem::FSeek64(m_file[slot], 0, SEEK_SET) != 0)
+		return false;
+
+	m_data[slot].resize(static_cast<size_t>(size));
+	if (rfread(m_data[slot].data(), m_data[slot].size(), 1, m_file[slot]) != 1)
+	{
+		m_data[slot] = {};
+		return false;
+	}
 
 	// If anyone knows why this filesize logic is here (it appears to be related to legacy PSX
 	// cards, perhaps hacked support for some special emulator-specific memcard formats that
 	// had header info?), then please replace this comment with something useful.  Thanks!  -- air
-
-	u32 offset = 0;
-
 	if (size == MCD_SIZE + 64)
-		offset = 64;
+		m_dataoffset[slot] = 64;
 	else if (size == MCD_SIZE + 3904)
-		offset = 3904;
-	return (FileSystem::FSeek64(f, adr + offset, SEEK_SET) == 0);
+		m_dataoffset[slot] = 3904;
+	else
+		m_dataoffset[slot] = 0;
+
+	m_dirty[slot].assign((m_data[slot].size() + MC2_ERASE_SIZE * 64 - 1) / (MC2_ERASE_SIZE * 64), 0);
+	return true;
+}
+
+// Returns null if the range is outside of the card.
+u8* FileMemoryCard::GetDataPtr(uint slot, u32 adr, int size)
+{
+	const u64 start = static_cast<u64>(adr) + m_dataoffset[slot];
+	if (size < 0 || start + static_cast<u64>(size) > m_data[slot].size())
+		return nullptr;
+
+	return m_data[slot].data() + start;
+}
+
+// Must be called with m_data_mutex held.
+void FileMemoryCard::MarkDirty(uint slot, u32 adr, int size)
+{
+	if (size <= 0)
+		return;
+
+	const u64 start = static_cast<u64>(adr) + m_dataoffset[slot];
+	const u64 first = start / MC2_ERASE_SIZE;
+	const u64 last = (start + size - 1) / MC2_ERASE_SIZE;
+	for (u64 block = first; block <= last; block++)
+		m_dirty[slot][block / 64] |= 1ULL << (block % 64);
+
+	if (!m_anydirty)
+	{
+		m_anydirty = true;
+		m_flush_cv.notify_one();
+	}
+}
+
+void FileMemoryCard::Flush()
+{
+	std::unique_lock flush_lock(m_flush_mutex);
+
+	for (uint slot = 0; slot < 8; ++slot)
+	{
+		if (!m_file[slot])
+			continue;
+
+		// Copy the dirty runs out, so the emulator can keep writing while we're in the file.
+		std::vector<std::pair<u64, std::vector<u8>>> runs;
+		{
+			std::unique_lock lock(m_data_mutex);
+			const u64 num_blocks = (m_data[slot].size() + MC2_ERASE_SIZE - 1) / MC2_ERASE_SIZE;
+			for (u64 block = 0; block < num_blocks;)
+			{
+				if (!(m_dirty[slot][block / 64] & (1ULL << (block % 64))))
+				{
+					block++;
+					continue;
+				}
+
+				const u64 first = block;
+				for (; block < num_blocks && (m_dirty[slot][block / 64] & (1ULL << (block % 64))); block++)
+					m_dirty[slot][block / 64] &= ~(1ULL << (block % 64));
+
+				const u64 start = first * MC2_ERASE_SIZE;
+				const u64 end = std::min<u64>(block * MC2_ERASE_SIZE, m_data[slot].size());
+				runs.emplace_back(start, std::vector<u8>(m_data[slot].begin() + start, m_data[slot].begin() + end));
+			}
+		}
+
+		for (const auto& [offset, data] : runs)
+		{
+			if (FileSystem::FSeek64(m_file[slot], offset, SEEK_SET) != 0 ||
+				rfwrite(data.data(), data.size(), 1, m_file[slot]) != 1)
+			{
+				Console.Error("Failed to write memory card %u at offset %llu.", slot, static_cast<unsigned long long>(offset));
+			}
+		}
+
+		if (!runs.empty())
+		{
+			if (!m_ispsx[slot] && FileSystem::FSeek64(m_file[slot], m_chkaddr, SEEK_SET) == 0)
+				rfwrite(&m_chksum[slot], sizeof(m_chksum[slot]), 1, m_file[slot]);
+			filestream_flush(m_file[slot]);
+		}
+	}
+}
+
+void FileMemoryCard::FlushThread()
+{
+	std::unique_lock lock(m_data_mutex);
+	for (;;)
+	{
+		m_flush_cv.wait(lock, [this]() { return m_anydirty || m_flush_quit; });
+		if (m_flush_quit)
+			break;
+
+		// Let the burst finish, but never keep data in memory longer than the interval.
+		m_flush_cv.wait_for(lock, std::chrono::milliseconds(MCD_FLUSH_INTERVAL_MS), [this]() { return m_flush_quit; });
+		m_anydirty = false;
+
+		lock.unlock();
+		Flush();
+		lock.lock();
+	}
 }
 
 // returns FALSE if an error occurred (either permission denied or disk full)
@@ -417,7 +575,7 @@ void FileMemoryCard::GetSizeInfo(uint slot, McdSizeInfo& outways)
 	outways.Xor = 18;                     // 0x12, XOR 02 00 00 10
 
 	if (m_file[slot])
-		outways.McdSizeInSectors = static_cast<u32>(FileSystem::FSize64(m_file[slot])) / (outways.SectorSize + outways.EraseBlockSizeInSectors);
+		outways.McdSizeInSectors = static_cast<u32>(m_data[slot].size()) / (outways.SectorSize + outways.EraseBlockSizeInSectors);
 	else
 		outways.McdSizeInSectors = 0x4000;
 
@@ -432,102 +590,86 @@ bool FileMemoryCard::IsPSX(uint slot)
 
 s32 FileMemoryCard::Read(uint slot, u8* dest, u32 adr, int size)
 {
-	RFILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		memset(dest, 0, size);
 		return 1;
 	}
-	if (!Seek(mcfp, adr))
+
+	std::unique_lock lock(m_data_mutex);
+	const u8* src = GetDataPtr(slot, adr, size);
+	if (!src)
 		return 0;
-	return rfread(dest, size, 1, mcfp) == 1;
+
+	std::memcpy(dest, src, size);
+	return 1;
 }
 
 s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 {
-	RFILE* mcfp = m_file[slot];
-
-	if (!mcfp)
+	if (!m_file[slot])
 		return 1;
 
+	std::unique_lock lock(m_data_mutex);
+	u8* dst = GetDataPtr(slot, adr, size);
+	if (!dst)
+		return 0;
+
 	if (m_ispsx[slot])
 	{
-		if (static_cast<int>(m_currentdata.size()) < size)
-			m_currentdata.resize(size);
-		for (int i = 0; i < size; i++)
-			m_currentdata[i] = src[i];
+		std::memcpy(dst, src, size);
 	}
 	else
 	{
-		if (!Seek(mcfp, adr))
-			return 0;
-		if (static_cast<int>(m_currentdata.size()) < size)
-			m_currentdata.resize(size);
-
-		rfread(m_currentdata.data(), size, 1, mcfp);
-
+		// Flash can only clear bits, erasing sets them.
 		for (int i = 0; i < size; i++)
-			m_currentdata[i] &= src[i];
+			dst[i] &= src[i];
 
 		// Checksumness
+		for (int i = 0; i + 8 <= size; i += 8)
 		{
-			u64* pdata = (u64*)&m_currentdata[0];
-			u32 loops = size / 8;
-
-			for (u32 i = 0; i < loops; i++)
-				m_chksum[slot] ^= pdata[i];
+			u64 value;
+			std::memcpy(&value, dst + i, sizeof(value));
+			m_chksum[slot] ^= value;
 		}
 	}
 
-	if (!Seek(mcfp, adr))
-		return 0;
-
-	if (rfwrite(m_currentdata.data(), size, 1, mcfp) == 1)
-		return 1;
-
-	return 0;
+	MarkDirty(slot, adr, size);
+	return 1;
 }
 
 s32 FileMemoryCard::EraseBlock(uint slot, u32 adr)
 {
-	u8 buf[MC2_ERASE_SIZE];
-	RFILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 		return 1;
 
-	if (!Seek(mcfp, adr))
+	std::unique_lock lock(m_data_mutex);
+	u8* dst = GetDataPtr(slot, adr, MC2_ERASE_SIZE);
+	if (!dst)
 		return 0;
-	memset(buf, 0xff, sizeof(buf));
-	return rfwrite(buf, sizeof(buf), 1, mcfp) == 1;
+
+	std::memset(dst, 0xff, MC2_ERASE_SIZE);
+	MarkDirty(slot, adr, MC2_ERASE_SIZE);
+	return 1;
 }
 
 u64 FileMemoryCard::GetCRC(uint slot)
 {
-	RFILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 		return 0;
 	if (m_ispsx[slot])
 	{
-		u64 retval = 0;
-		if (!Seek(mcfp, 0))
-			return 0;
-
-		const s64 mcfpsize = FileSystem::FSize64(mcfp);
-		if (mcfpsize < 0)
-			return 0;
-
-		// Process the file in 4k chunks.  Speeds things up significantly.
+		std::unique_lock lock(m_data_mutex);
 
-		u64 buffer[528 * 8]; // use 528 (sector size), ensures even divisibility
-
-		const uint filesize = static_cast<uint>(mcfpsize) / sizeof(buffer);
-		for (uint i = filesize; i; --i)
+		// Whole 4k chunks only, same as when this was read from the file.
+		u64 retval = 0;
+		const size_t chunk_size = 528 * 8 * sizeof(u64);
+		const size_t size = (m_data[slot].size() / chunk_size) * chunk_size;
+		for (size_t i = 0; i < size; i += sizeof(u64))
 		{
-			if (rfread(buffer, sizeof(buffer), 1, mcfp) != 1)
-				return 0;
-
-			for (uint t = 0; t < std::size(buffer); ++t)
-				retval ^= buffer[t];
+			u64 value;
+			std::memcpy(&value, &m_data[slot][i], sizeof(value));
+			retval ^= value;
 		}
 		return retval;
 	}
@@ -568,6 +710,12 @@ void FileMcd_EmuOpen(void)
 	Mcd::impl.Open();
 }
 
+void FileMcd_Flush(void)
+{
+	if (FileMcd_Open)
+		Mcd::impl.Flush();
+}
+
 void FileMcd_EmuClose(void)
 {
 	if(!FileMcd_Open)
@@ -26,30 +26,15 @@
 #include "Patch.h"
 #include "IopMem.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include <file/file_path.h>
 
-enum patch_cpu_type {
-	NO_CPU = 0,
-	CPU_EE,
-	CPU_IOP
-};
-
-enum patch_data_type {
-	NO_TYPE = 0,
-	BYTE_T,
-	SHORT_T,
-	WORD_T,
-	DOUBLE_T,
-	EXTENDED_T,
-	SHORT_LE_T,
-	WORD_LE_T,
-	DOUBLE_LE_T
-};
-
 
 static u32 SkipCount          = 0;
 static u32 IterationCount     = 0;
@@ -608,18 +593,19 @@ void _ApplyPatch(IniPatch *p)
 	}
 }
 
-static void _ApplyDynaPatch(const DynamicPatch& patch, u32 address)
+static bool _ApplyDynaPatch(const DynamicPatch& patch, u32 address)
 {
 	for (const auto& pattern : patch.pattern)
 	{
 		if (*static_cast<u32*>(PSM(address + pattern.offset)) != pattern.value)
-			return;
+			return false;
 	}
 
 	Console.WriteLn("Applying Dynamic Patch to address 0x%08X", address);
 	// If everything passes, apply the patch.
 	for (const auto& replacement : patch.replacement)
 		memWrite32(address + replacement.offset, replacement.value);
+	return true;
 }
 
 // This is a declaration for PatchMemory.cpp::_ApplyPatch where we're (patch.cpp)
@@ -628,6 +614,72 @@ static void _ApplyDynaPatch(const DynamicPatch& patch, u32 address)
 
 std::vector<IniPatch> Patch;
 static std::vector<DynamicPatch> DynaPatch;
+static std::vector<u32> DynaPatchHits;
+
+// Dynamic patches are checked for every recompiled instruction, so rather than running every
+// pattern at every pc, patches are grouped by one "anchor" word of their pattern (the opcode
+// at offset 0 when there is one). A one-bit-per-value filter rejects most instructions with a
+// single load, and only patches whose anchor word matches get their full pattern checked.
+static constexpr u32 DYNA_FILTER_BITS = 1024;
+
+struct DynaPatchGroup
+{
+	u32 offset; // Pattern offset of the anchor word
+	u64 filter[DYNA_FILTER_BITS / 64];
+	std::unordered_multimap<u32, size_t> patches; // Anchor value -> index into DynaPatch
+};
+
+static std::vector<DynaPatchGroup> DynaPatchIndex;
+static std::vector<size_t> DynaPatchUnanchored; // Patches with an empty pattern, which match everywhere
+
+static __fi u32 DynaFilterBit(u32 value)
+{
+	return (value * 0x9E3779B1u) >> (32 - 10);
+}
+static_assert(DYNA_FILTER_BITS == (1u << 10));
+
+static void BuildDynaPatchIndex()
+{
+	DynaPatchIndex.clear();
+	DynaPatchUnanchored.clear();
+	DynaPatchHits.assign(DynaPatch.size(), 0);
+
+	for (size_t i = 0; i < DynaPatch.size(); i++)
+	{
+		const std::vector<DynamicPatchEntry>& pattern = DynaPatch[i].pattern;
+		if (pattern.empty())
+		{
+			DynaPatchUnanchored.push_back(i);
+			continue;
+		}
+
+		auto anchor = std::find_if(pattern.begin(), pattern.end(), [](const DynamicPatchEntry& e) { return e.offset == 0; });
+		if (anchor == pattern.end())
+			anchor = pattern.begin();
+
+		auto group = std::find_if(DynaPatchIndex.begin(), DynaPatchIndex.end(),
+			[&](const DynaPatchGroup& g) { return g.offset == anchor->offset; });
+		if (group == DynaPatchIndex.end())
+		{
+			group = DynaPatchIndex.emplace(DynaPatchIndex.end());
+			group->offset = anchor->offset;
+			std::memset(group->filter, 0, sizeof(group->filter));
+		}
+
+		const u32 bit = DynaFilterBit(anchor->value);
+		group->filter[bit / 64] |= 1ull << (bit % 64);
+		group->patches.emplace(anchor->value, i);
+	}
+}
+
+static void LogDynaPatchHits()
+{
+	for (size_t i = 0; i < DynaPatchHits.size(); i++)
+	{
+		if (DynaPatchHits[i] > 0)
+			Console.WriteLn("Dynamic Patch %zu was applied %u times", i, DynaPatchHits[i]);
+	}
+}
 
 struct PatchTextTable
 {
@@ -729,10 +781,18 @@ int LoadPatchesFromString(const std::string& patches)
 	return static_cast<int>(Patch.size() - before);
 }
 
+int LoadPatches(const IniPatch* patches, size_t count)
+{
+	Patch.insert(Patch.end(), patches, patches + count);
+	return static_cast<int>(count);
+}
+
 void ForgetLoadedPatches(void)
 {
 	Patch.clear();
+	LogDynaPatchHits();
 	DynaPatch.clear();
+	BuildDynaPatchIndex();
 }
 
 // This routine loads patches from a zip file
@@ -866,10 +926,35 @@ namespace PatchFunc
 
 void ApplyDynamicPatches(u32 pc)
 {
-	for (const auto& dynpatch : DynaPatch)
+	for (const DynaPatchGroup& group : DynaPatchIndex)
 	{
-		_ApplyDynaPatch(dynpatch, pc);
+		const u32* word = static_cast<const u32*>(PSM(pc + group.offset));
+		if (!word)
+			continue;
+
+		const u32 value = *word;
+		const u32 bit = DynaFilterBit(value);
+		if (!(group.filter[bit / 64] & (1ull << (bit % 64))))
+			continue;
+
+		const auto range = group.patches.equal_range(value);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (_ApplyDynaPatch(DynaPatch[it->second], pc))
+				DynaPatchHits[it->second]++;
+		}
 	}
+
+	for (size_t i : DynaPatchUnanchored)
+	{
+		if (_ApplyDynaPatch(DynaPatch[i], pc))
+			DynaPatchHits[i]++;
+	}
+}
+
+bool HasDynamicPatches()
+{
+	return !DynaPatch.empty();
 }
 
 void LoadDynamicPatches(const std::vector<DynamicPatch>& patches)
@@ -877,4 +962,5 @@ void LoadDynamicPatches(const std::vector<DynamicPatch>& patches)
 	for (const DynamicPatch& it : patches){
 		DynaPatch.push_back(it);
 	}
+	BuildDynaPatchIndex();
 }
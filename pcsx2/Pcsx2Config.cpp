@@ -296,6 +296,13 @@ void Pcsx2Config::RecompilerOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableVU0);
 	SettingsWrapBitBool(EnableVU1);
 	SettingsWrapBitBool(EnableFastmem);
+	SettingsWrapBitBool(EnableTieredCompilation);
+	SettingsWrapBitBool(EnableVUTieredCompilation);
+	SettingsWrapBitBool(EnableEELoopRegisterCarry);
+	SettingsWrapBitBool(EnableEELoopIdioms);
+	SettingsWrapBitBool(EnableVUAVX);
+	SettingsWrapBitBool(EnableBlockProfiler);
+	SettingsWrapBitBool(EnableVUProgramStats);
 
 	SettingsWrapBitBool(vu0Overflow);
 	SettingsWrapBitBool(vu0ExtraOverflow);
@@ -406,6 +413,7 @@ Pcsx2Config::GSOptions::GSOptions()
 	DisableFramebufferFetch = false;
 	DisableVertexShaderExpand = false;
 	SkipDuplicateFrames = false;
+	SWQueueStats = false;
 
 	HWDownloadMode = GSHardwareDownloadMode::Enabled;
 	GPUPaletteConversion = false;
@@ -525,6 +533,7 @@ void Pcsx2Config::GSOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(DisableFramebufferFetch);
 	SettingsWrapBitBool(DisableVertexShaderExpand);
 	SettingsWrapBitBool(SkipDuplicateFrames);
+	SettingsWrapBitBool(SWQueueStats);
 
 	SettingsWrapBitBoolEx(GPUPaletteConversion, "paltex");
 	SettingsWrapBitBoolEx(AutoFlushSW, "autoflush_sw");
@@ -931,6 +940,9 @@ void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableNoInterlacingPatches);
 	SettingsWrapBitBool(EnableGameFixes);
 	SettingsWrapBitBool(HostFs);
+	SettingsWrapBitBool(EnableHugePages);
+	SettingsWrapBitBool(CdvdPreload);
+	SettingsWrapBitBool(CdvdTrace);
 
 	SettingsWrapBitBool(McdEnableEjection);
 	SettingsWrapBitBool(McdFolderAutoManage);
@@ -205,6 +205,10 @@ extern void psxReset(void);
 extern void psxException(u32 code, u32 step);
 extern void iopEventTest(void);
 
+// Interprets up to and including the next taken branch. Used by the recompiler to run
+// blocks which haven't been executed often enough to be worth compiling yet.
+extern void psxInterpretBlock(void);
+
 // Subsets
 extern void (*psxBSC[64])();
 extern void (*psxSPC[64])();
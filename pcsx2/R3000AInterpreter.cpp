@@ -21,6 +21,11 @@
 #include "R5900OpcodeTables.h"
 #include "IopBios.h"
 #include "IopHw.h"
+#include "IopMem.h"
+#include "InterpreterBlockCache.h"
+
+#include <array>
+#include <utility>
 
 // Used to flag delay slot instructions when throwig exceptions.
 bool iopIsDelaySlot = false;
@@ -28,6 +33,23 @@ bool iopIsDelaySlot = false;
 static bool branch2 = 0;
 static u32 branchPC;
 
+struct IntInst
+{
+	void (*interpret)();
+	u32 code;
+	u32 words;
+};
+
+using IntBlockCache = InterpreterBlockCache<IntInst, 32, 2048>;
+static IntBlockCache s_blocks;
+
+// The pc psxCpu->Clear() is called with for the same code, with the kseg and RAM mirrors removed.
+static __fi u32 psxBlockKey(u32 pc)
+{
+	pc &= 0x1fffffff;
+	return (pc < 0x00800000) ? (pc & (Ps2MemSize::IopRam - 1)) : pc;
+}
+
 static __fi void execI(void)
 {
 	// Inject IRX hack
@@ -51,6 +73,156 @@ static __fi void execI(void)
 	psxBSC[psxRegs.code >> 26]();
 }
 
+// LUI followed by an ADDIU or ORI of the same register just loads a constant, so the pair is decoded
+// into a single instruction, with the constant in place of the code.
+template <u32 rt>
+static void psxLoadConstant()
+{
+	psxRegs.GPR.r[rt] = psxRegs.code;
+}
+
+template <size_t... rt>
+static constexpr std::array<void (*)(), sizeof...(rt)> psxMakeLoadConstants(std::index_sequence<rt...>)
+{
+	return {{&psxLoadConstant<rt>...}};
+}
+
+static constexpr std::array<void (*)(), 32> s_load_constant = psxMakeLoadConstants(std::make_index_sequence<32>());
+
+static bool psxFuseLoadConstant(IntInst& inst, u32 next)
+{
+	const u32 rt = (inst.code >> 16) & 0x1F;
+	if ((inst.code >> 26) != 0x0F || rt == 0 || ((next >> 21) & 0x1F) != rt || ((next >> 16) & 0x1F) != rt)
+		return false;
+
+	const u32 upper = inst.code << 16;
+	if ((next >> 26) == 0x09) // ADDIU
+		inst.code = upper + static_cast<u32>(static_cast<s16>(next));
+	else if ((next >> 26) == 0x0D) // ORI
+		inst.code = upper | (next & 0xFFFF);
+	else
+		return false;
+
+	inst.interpret = s_load_constant[rt];
+	inst.words++;
+	return true;
+}
+
+// Resolves the handler through the sub-tables the psxSPECIAL() style handlers would dispatch to.
+static void (*psxDecodeHandler(u32 code))()
+{
+	switch (code >> 26)
+	{
+		case 0x00:
+			return psxSPC[code & 0x3F];
+		case 0x01:
+			return psxREG[(code >> 16) & 0x1F];
+		case 0x10:
+			return psxCP0[(code >> 21) & 0x1F];
+		case 0x12:
+			return (code & 0x3F) ? psxCP2[code & 0x3F] : psxCP2BSC[(code >> 21) & 0x1F];
+		default:
+			return psxBSC[code >> 26];
+	}
+}
+
+// Branches and jumps, which run their delay slot themselves, and SYSCALL/BREAK.
+static bool psxEndsBlock(u32 code)
+{
+	const u32 op = code >> 26;
+	if (op == 0x00)
+	{
+		const u32 funct = code & 0x3F;
+		return (funct == 0x08 || funct == 0x09 || funct == 0x0C || funct == 0x0D);
+	}
+
+	return (op >= 0x01 && op <= 0x07);
+}
+
+static IntBlockCache::Block* psxDecodeBlock(u32 pc)
+{
+	// Only RAM and the BIOS are cached. Every write to RAM from the IOP or DMA calls
+	// psxCpu->Clear(), and the BIOS never changes.
+	const u32 key = psxBlockKey(pc);
+	if (key >= Ps2MemSize::IopRam && key < 0x1fc00000)
+		return nullptr;
+
+	const u8* page = reinterpret_cast<const u8*>(psxMemRLUT[key >> 16]);
+	if (!page)
+		return nullptr;
+
+	const u32* code = reinterpret_cast<const u32*>(page + (key & 0xffff));
+
+	IntBlockCache::Block& block = s_blocks.Allocate(key);
+	const u32 max_words = std::min((IntBlockCache::PAGE_SIZE - (key & (IntBlockCache::PAGE_SIZE - 1))) / 4, s_blocks.MAX_WORDS);
+	while (block.words < max_words)
+	{
+		// The IRX injection in execI() has to run before the instruction there.
+		if (block.words > 0 && key + block.words * 4 == 0x1630)
+			break;
+
+		const u32 op = code[block.words++];
+
+		IntInst& inst = block.insts[block.count++];
+		inst.interpret = psxDecodeHandler(op);
+		inst.code = op;
+		inst.words = 1;
+
+		if (psxEndsBlock(op))
+			break;
+
+		if (block.words < max_words && key + block.words * 4 != 0x1630 && psxFuseLoadConstant(inst, code[block.words]))
+			block.words++;
+	}
+
+	s_blocks.Commit(block, key, key);
+	return &block;
+}
+
+// Runs the decoded block at the pc, or a single instruction if the code there can't be cached.
+// Fused instructions still count as two for the cycle counts.
+static void execBlock()
+{
+	const u32 pc = psxRegs.pc;
+	if (pc == 0x1630)
+	{
+		execI();
+		return;
+	}
+
+	const u32 key = psxBlockKey(pc);
+	IntBlockCache::Block* block = s_blocks.Lookup(key);
+	if (!block)
+	{
+		block = psxDecodeBlock(pc);
+		if (!block)
+		{
+			execI();
+			return;
+		}
+	}
+
+	u32 next_pc = pc;
+	for (u32 i = 0; i < block->count; i++)
+	{
+		const IntInst& inst = block->insts[i];
+		next_pc += inst.words * 4;
+		psxRegs.code = inst.code;
+		psxRegs.pc = next_pc;
+		psxRegs.cycle += inst.words;
+
+		if ((psxHu32(HW_ICFG) & (1 << 3)))
+			psxRegs.iopCycleEE -= 9 * inst.words;
+		else
+			psxRegs.iopCycleEE -= 8 * inst.words;
+
+		inst.interpret();
+
+		if (psxRegs.pc != next_pc || block->pc != key)
+			break;
+	}
+}
+
 static void doBranch(s32 tar)
 {
 	branch2 = iopIsDelaySlot = true;
@@ -160,9 +332,29 @@ void psxJALR(void)
 
 static void intReserve(void) { }
 static void intAlloc(void) { }
-static void intReset(void) { intAlloc(); }
-static void intClear(u32 Addr, u32 Size) { }
-static void intShutdown(void) { }
+
+static void intReset(void)
+{
+	intAlloc();
+	s_blocks.Reset();
+}
+
+static void intClear(u32 Addr, u32 Size)
+{
+	s_blocks.Invalidate(psxBlockKey(Addr), Size);
+}
+
+static void intShutdown(void)
+{
+	s_blocks.Shutdown();
+}
+
+void psxInterpretBlock(void)
+{
+	branch2 = 0;
+	while (!branch2)
+		execI();
+}
 
 static s32 intExecuteBlock( s32 eeCycles )
 {
@@ -176,7 +368,7 @@ static s32 intExecuteBlock( s32 eeCycles )
 
 		branch2 = 0;
 		while (!branch2)
-			execI();
+			execBlock();
 	}
 
 	return psxRegs.iopBreak + psxRegs.iopCycleEE;
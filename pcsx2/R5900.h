@@ -235,6 +235,10 @@ void intSetBranch();
 // parts of the Recs (namely COP0's branch codes and stuff).
 void intDoBranch(u32 target);
 
+// Interprets up to and including the next taken branch. Used by the recompiler to run
+// blocks which haven't been executed often enough to be worth compiling yet.
+void intInterpretBlock();
+
 // modules loaded at hardcoded addresses by the kernel
 const u32 EEKERNEL_START	= 0;
 const u32 EENULL_START		= 0x81FC0;
@@ -700,6 +700,9 @@ bool SaveStateBase::sio2Freeze()
 	u64 mcdCrcs[SIO::PORTS][SIO::SLOTS];
 	if (IsSaving())
 	{
+		// Make sure the files match the state we're saving.
+		FileMcd_Flush();
+
 		for (u32 port = 0; port < SIO::PORTS; port++)
 		{
 			for (u32 slot = 0; slot < SIO::SLOTS; slot++)
@@ -58,6 +58,7 @@
 #include "ps2/BiosTools.h"
 
 #include "DebugTools/MIPSAnalyst.h"
+#include "x86/RecProfiler.h"
 
 #ifdef _WIN32
 #include "common/RedtapeWindows.h"
@@ -654,6 +655,9 @@ void VMManager::Shutdown()
 		vu1Thread.WaitVU();
 	MTGS::WaitGS(false);
 
+	// Also closes the perf map, which may be open even if the profiler was turned off since.
+	RecProfiler::WriteReport(GetDiscSerial());
+
 	{
 		LastELF.clear();
 		DiscSerial.clear();
@@ -803,6 +807,8 @@ void VMManager::ShutdownCPUProviders()
 	psxRec.Shutdown();
 	recCpu.Shutdown();
 
+	psxInt.Shutdown();
+	intCpu.Shutdown();
 }
 
 void VMManager::UpdateCPUImplementations()
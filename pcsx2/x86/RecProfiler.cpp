@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "RecProfiler.h"
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/StringUtil.h"
+#include "common/emitter/x86emitter.h"
+
+#include "Config.h"
+#include "DebugTools/SymbolMap.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <time.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace x86Emitter;
+
+namespace RecProfiler
+{
+	struct BlockProfile
+	{
+		u64 entries;
+		u32 pc;
+		u32 insts;
+	};
+
+	/// Profiles are never freed, since blocks compiled with their counter address may still run.
+	/// Each CPU's profiles are only touched by the thread compiling for it (VU1 may be on the MTVU thread).
+	struct CpuProfiles
+	{
+		std::deque<BlockProfile> storage;
+		std::unordered_map<u32, BlockProfile*> lookup;
+	};
+
+	static constexpr const char* s_cpu_names[] = {"EE", "IOP", "VU0", "VU1"};
+	static CpuProfiles s_profiles[static_cast<int>(Cpu::Count)];
+
+	static constexpr size_t REPORT_TOP_BLOCKS = 50;
+	static constexpr size_t PERF_MAP_FLUSH_SIZE = 64 * 1024;
+
+	static std::mutex s_perf_map_lock;
+	static RFILE* s_perf_map = nullptr;
+	static bool s_perf_map_failed = false;
+	static std::string s_perf_map_buffer;
+
+	static BlockProfile& GetProfile(Cpu cpu, u32 pc)
+	{
+		CpuProfiles& profiles = s_profiles[static_cast<int>(cpu)];
+		BlockProfile*& profile = profiles.lookup[pc];
+		if (!profile)
+			profile = &profiles.storage.emplace_back(BlockProfile{0, pc, 0});
+		return *profile;
+	}
+
+	static SymbolMap* GetSymbolMap(Cpu cpu)
+	{
+		switch (cpu)
+		{
+			case Cpu::EE:
+				return &R5900SymbolMap;
+			case Cpu::IOP:
+				return &R3000SymbolMap;
+			default:
+				return nullptr;
+		}
+	}
+
+	static std::string GetBlockName(Cpu cpu, u32 pc)
+	{
+		std::string name(StringUtil::StdStringFromFormat("%s_%08x", s_cpu_names[static_cast<int>(cpu)], pc));
+
+		std::string label;
+		u32 offset;
+		const SymbolMap* map = GetSymbolMap(cpu);
+		if (map && !map->IsEmpty() && map->GetNearestLabel(pc, &label, &offset))
+			name += StringUtil::StdStringFromFormat(" %s+0x%x", label.c_str(), offset);
+
+		return name;
+	}
+
+	static void FlushPerfMap()
+	{
+		if (s_perf_map_buffer.empty())
+			return;
+
+		if (rfwrite(s_perf_map_buffer.data(), s_perf_map_buffer.size(), 1, s_perf_map) != 1)
+			Console.Error("RecProfiler: Failed to write perf map.");
+		s_perf_map_buffer.clear();
+	}
+
+	static bool OpenPerfMap()
+	{
+#ifdef _WIN32
+		return false;
+#else
+		if (s_perf_map)
+			return true;
+		if (s_perf_map_failed)
+			return false;
+
+		// perf looks for the map by pid, and only in /tmp.
+		const std::string path(StringUtil::StdStringFromFormat("/tmp/perf-%d.map", static_cast<int>(getpid())));
+		s_perf_map = FileSystem::OpenFile(path.c_str(), "wb");
+		if (!s_perf_map)
+		{
+			Console.Error("RecProfiler: Unable to create perf map '%s'.", path.c_str());
+			s_perf_map_failed = true;
+			return false;
+		}
+
+		Console.WriteLn("RecProfiler: Writing perf map to '%s'.", path.c_str());
+		return true;
+#endif
+	}
+} // namespace RecProfiler
+
+bool RecProfiler::IsEnabled()
+{
+	return EmuConfig.Cpu.Recompiler.EnableBlockProfiler;
+}
+
+void RecProfiler::EmitBlockEntry(Cpu cpu, u32 pc)
+{
+	BlockProfile& profile = GetProfile(cpu, pc);
+
+	// The counters live on the heap, which may be out of rip-relative range of the code cache.
+	xLoadFarAddr(rax, &profile.entries);
+	xADD(ptr64[rax], 1);
+}
+
+void RecProfiler::RegisterBlock(Cpu cpu, u32 pc, u32 guest_insts, const void* code, u32 code_size)
+{
+	GetProfile(cpu, pc).insts = guest_insts;
+
+	if (code_size == 0)
+		return;
+
+	const std::string name(GetBlockName(cpu, pc));
+
+	std::unique_lock lock(s_perf_map_lock);
+	if (!OpenPerfMap())
+		return;
+
+	char line[64];
+	const int len = std::snprintf(line, sizeof(line), "%" PRIxPTR " %x ", reinterpret_cast<uptr>(code), code_size);
+	s_perf_map_buffer.append(line, len);
+	s_perf_map_buffer.append(name);
+	s_perf_map_buffer.push_back('\n');
+	if (s_perf_map_buffer.size() >= PERF_MAP_FLUSH_SIZE)
+		FlushPerfMap();
+}
+
+void RecProfiler::WriteReport(const std::string& serial)
+{
+	{
+		// The code cache is reset with the VM, so the next one starts a new map.
+		std::unique_lock lock(s_perf_map_lock);
+		if (s_perf_map)
+		{
+			FlushPerfMap();
+			rfclose(s_perf_map);
+			s_perf_map = nullptr;
+		}
+		s_perf_map_buffer = {};
+		s_perf_map_failed = false;
+	}
+
+	std::string report;
+	for (int i = 0; i < static_cast<int>(Cpu::Count); i++)
+	{
+		CpuProfiles& profiles = s_profiles[i];
+
+		u64 total = 0;
+		std::vector<BlockProfile*> hot;
+		for (BlockProfile& profile : profiles.storage)
+		{
+			if (profile.entries == 0)
+				continue;
+			total += profile.entries * std::max<u32>(profile.insts, 1);
+			hot.push_back(&profile);
+		}
+		if (hot.empty())
+			continue;
+
+		// Rank by guest instructions run rather than entries, so long blocks aren't hidden behind short ones.
+		const auto weight = [](const BlockProfile* p) { return p->entries * std::max<u32>(p->insts, 1); };
+		const size_t count = std::min(hot.size(), REPORT_TOP_BLOCKS);
+		std::partial_sort(hot.begin(), hot.begin() + count, hot.end(),
+			[&weight](const BlockProfile* a, const BlockProfile* b) { return weight(a) > weight(b); });
+
+		report += StringUtil::StdStringFromFormat("%s: %zu blocks run, ~%llu instructions\n", s_cpu_names[i], hot.size(),
+			static_cast<unsigned long long>(total));
+		report += "       pc      entries  insts      %  symbol\n";
+		for (size_t j = 0; j < count; j++)
+		{
+			const BlockProfile* p = hot[j];
+			std::string label;
+			u32 offset;
+			const SymbolMap* map = GetSymbolMap(static_cast<Cpu>(i));
+			if (!map || map->IsEmpty() || !map->GetNearestLabel(p->pc, &label, &offset))
+				label.clear();
+			else
+				label += StringUtil::StdStringFromFormat("+0x%x", offset);
+
+			report += StringUtil::StdStringFromFormat("%08x %12llu %6u %6.2f  %s\n", p->pc,
+				static_cast<unsigned long long>(p->entries), p->insts, weight(p) * 100.0 / total, label.c_str());
+		}
+		report += "\n";
+
+		for (BlockProfile& profile : profiles.storage)
+			profile.entries = 0;
+	}
+
+	if (report.empty() || EmuFolders::Cache.empty())
+		return;
+
+	const std::string path(Path::Combine(EmuFolders::Cache,
+		StringUtil::StdStringFromFormat("profile_%s_%lld.txt", serial.empty() ? "unknown" : serial.c_str(),
+			static_cast<long long>(time(nullptr)))));
+	RFILE* fp = FileSystem::OpenFile(path.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("RecProfiler: Unable to create report '%s'.", path.c_str());
+		return;
+	}
+
+	if (rfwrite(report.data(), report.size(), 1, fp) != 1)
+		Console.Error("RecProfiler: Failed to write report '%s'.", path.c_str());
+	else
+		Console.WriteLn("RecProfiler: Wrote hot block report to '%s'.", path.c_str());
+	rfclose(fp);
+}
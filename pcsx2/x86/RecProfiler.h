@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: LGPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <string>
+
+/// Block-level profiling of recompiled code, enabled with EnableBlockProfiler.
+/// Each block entry increments a counter keyed by the guest start PC, which survives recompiles of the
+/// same PC. Counts are weighted by the block's guest instruction count to rank hot code, and written
+/// to a report in the cache folder when the VM shuts down. Compiled blocks are also listed in a
+/// perf JIT map (/tmp/perf-<pid>.map), so Linux perf can symbolize recompiled code.
+namespace RecProfiler
+{
+	enum class Cpu : u8
+	{
+		EE,
+		IOP,
+		VU0,
+		VU1,
+		Count
+	};
+
+	/// Returns true if blocks should be profiled.
+	bool IsEnabled();
+
+	/// Emits the entry counter for the block starting at pc. Clobbers rax and the flags.
+	void EmitBlockEntry(Cpu cpu, u32 pc);
+
+	/// Records the size and host code of a block once it's compiled.
+	void RegisterBlock(Cpu cpu, u32 pc, u32 guest_insts, const void* code, u32 code_size);
+
+	/// Writes the hot block report for the game that was running, and resets the counters.
+	void WriteReport(const std::string& serial);
+} // namespace RecProfiler
@@ -25,6 +25,7 @@
 #include "R5900OpcodeTables.h"
 #include "iR5900.h"
 #include "iMMI.h"
+#include "common/Console.h"
 #include "common/MathUtils.h"
 
 using namespace x86Emitter;
@@ -54,6 +55,84 @@ REC_FUNC_DEL(PSLLW, _Rd_);
 
 #else
 
+// Runs the interpreter beside the hand written divides and PMFHL.SLW, and logs every
+// instruction where LO, HI or Rd differ.
+//#define MMI_SELFCHECK
+
+#ifdef MMI_SELFCHECK
+static GPR_reg s_checkRs, s_checkRt, s_checkRd, s_checkLO, s_checkHI;
+
+static void recMMICheckBegin(u32 code)
+{
+	const u32 old_code = cpuRegs.code;
+	cpuRegs.code = code;
+	s_checkRs = cpuRegs.GPR.r[_Rs_];
+	s_checkRt = cpuRegs.GPR.r[_Rt_];
+	s_checkRd = cpuRegs.GPR.r[_Rd_];
+	s_checkLO = cpuRegs.LO;
+	s_checkHI = cpuRegs.HI;
+	cpuRegs.code = old_code;
+}
+
+static void recMMICheckLog(const char* name, const GPR_reg& rd, const GPR_reg& lo, const GPR_reg& hi)
+{
+	Console.Error("  %s rd %08x %08x %08x %08x, lo %08x %08x %08x %08x, hi %08x %08x %08x %08x", name,
+		rd.UL[3], rd.UL[2], rd.UL[1], rd.UL[0], lo.UL[3], lo.UL[2], lo.UL[1], lo.UL[0],
+		hi.UL[3], hi.UL[2], hi.UL[1], hi.UL[0]);
+}
+
+// Reruns the instruction through the interpreter on the inputs saved by recMMICheckBegin, then
+// puts the recompiled results back.
+template <void (*op)()>
+static void recMMICheckEnd(u32 code)
+{
+	const u32 old_code = cpuRegs.code;
+	cpuRegs.code = code;
+
+	const GPR_reg rd = cpuRegs.GPR.r[_Rd_];
+	const GPR_reg lo = cpuRegs.LO;
+	const GPR_reg hi = cpuRegs.HI;
+
+	cpuRegs.GPR.r[_Rd_] = s_checkRd;
+	cpuRegs.GPR.r[_Rt_] = s_checkRt;
+	cpuRegs.GPR.r[_Rs_] = s_checkRs;
+	cpuRegs.LO = s_checkLO;
+	cpuRegs.HI = s_checkHI;
+	op();
+
+	if (cpuRegs.GPR.r[_Rd_].UD[0] != rd.UD[0] || cpuRegs.GPR.r[_Rd_].UD[1] != rd.UD[1] ||
+		cpuRegs.LO.UD[0] != lo.UD[0] || cpuRegs.LO.UD[1] != lo.UD[1] ||
+		cpuRegs.HI.UD[0] != hi.UD[0] || cpuRegs.HI.UD[1] != hi.UD[1])
+	{
+		Console.Error("MMI mismatch: code %08x, rs %08x %08x %08x %08x, rt %08x %08x %08x %08x", code,
+			s_checkRs.UL[3], s_checkRs.UL[2], s_checkRs.UL[1], s_checkRs.UL[0],
+			s_checkRt.UL[3], s_checkRt.UL[2], s_checkRt.UL[1], s_checkRt.UL[0]);
+		recMMICheckLog("rec", rd, lo, hi);
+		recMMICheckLog("int", cpuRegs.GPR.r[_Rd_], cpuRegs.LO, cpuRegs.HI);
+	}
+
+	cpuRegs.GPR.r[_Rd_] = rd;
+	cpuRegs.LO = lo;
+	cpuRegs.HI = hi;
+	cpuRegs.code = old_code;
+}
+
+// Both calls write everything back to cpuRegs first, so the check sees what the block would.
+#define MMI_CHECK_BEGIN() \
+	do { \
+		iFlushCall(FLUSH_INTERPRETER); \
+		xFastCall((const void*)recMMICheckBegin, cpuRegs.code); \
+	} while (0)
+#define MMI_CHECK_END(f) \
+	do { \
+		iFlushCall(FLUSH_INTERPRETER); \
+		xFastCall((const void*)recMMICheckEnd<Interp::f>, cpuRegs.code); \
+	} while (0)
+#else
+#define MMI_CHECK_BEGIN() do {} while (0)
+#define MMI_CHECK_END(f) do {} while (0)
+#endif
+
 void recPLZCW()
 {
 	int x86regs = -1;
@@ -156,6 +235,9 @@ void recPMFHL()
 	if (!_Rd_)
 		return;
 
+	if (_Sa_ == 0x02)
+		MMI_CHECK_BEGIN();
+
 	int info = eeRecompileCodeXMM(XMMINFO_WRITED | XMMINFO_READLO | XMMINFO_READHI);
 
 	int t0reg;
@@ -181,10 +263,29 @@ void recPMFHL()
 			break;
 
 		case 0x02: // SLW
-			// fall to interp
-			_deleteEEreg(_Rd_, 0);
-			iFlushCall(FLUSH_INTERPRETER); // since calling CALLFunc
-			xFastCall((void*)(uptr)R5900::Interpreter::OpcodeImpl::MMI::PMFHL);
+			// saturate each HI:LO doubleword to 32 bits, then sign extend
+			for (int i = 0; i < 2; i++)
+			{
+				xPEXTR.D(eax, xRegisterSSE(EEREC_LO), i * 2);
+				xPEXTR.D(edx, xRegisterSSE(EEREC_HI), i * 2);
+				xSHL(rdx, 32);
+				xOR(rax, rdx);
+
+				xCMP(rax, 0x7fffffff);
+				u8* notPos = JL8(0);
+				xMOV(eax, 0x7fffffff);
+				u8* done = JMP8(0);
+
+				x86SetJ8(notPos);
+				xCMP(rax, static_cast<s32>(0x80000000));
+				u8* inRange = JG8(0);
+				xMOV(eax, 0x80000000);
+
+				x86SetJ8(inRange);
+				x86SetJ8(done);
+				xPINSR.D(xRegisterSSE(EEREC_D), eax, i);
+			}
+			xPMOVSX.DQ(xRegisterSSE(EEREC_D), xRegisterSSE(EEREC_D));
 			break;
 
 		case 0x03: // LH
@@ -219,6 +320,9 @@ void recPMFHL()
 	}
 
 	_clearNeededXMMregs();
+
+	if (_Sa_ == 0x02)
+		MMI_CHECK_END(PMFHL);
 }
 
 void recPMTHL()
@@ -1992,18 +2096,118 @@ void recPMULTW(void)
 	}
 	_clearNeededXMMregs();
 }
+////////////////////////////////////////////////////
+// Divides word slane of Rs by word tlane of Rt (or the sign extended low halfword of Rt),
+// leaving the quotient in eax and the remainder in edx. Overflow and divide by zero
+// give the same results as DIV/DIVU, since x86 would raise an exception instead.
+static void recPDIVLane(int info, int slane, int tlane, bool sign, bool halfword)
+{
+	xPEXTR.D(eax, xRegisterSSE(EEREC_S), slane);
+	if (halfword)
+	{
+		xMOVD(ecx, xRegisterSSE(EEREC_T));
+		xMOVSX(ecx, cx);
+	}
+	else
+	{
+		xPEXTR.D(ecx, xRegisterSSE(EEREC_T), tlane);
+	}
+
+	u8* end1 = nullptr;
+	if (sign)
+	{
+		xCMP(eax, 0x80000000);
+		u8* cont1 = JNE8(0);
+		xCMP(ecx, 0xffffffff);
+		u8* cont2 = JNE8(0);
+		//overflow case:
+		xXOR(edx, edx); //EAX remains 0x80000000
+		end1 = JMP8(0);
+
+		x86SetJ8(cont1);
+		x86SetJ8(cont2);
+	}
+
+	xTEST(ecx, ecx);
+	u8* cont3 = JNZ8(0);
+	//divide by zero
+	xMOV(edx, eax);
+	if (sign) //set EAX to (EAX < 0)?1:-1
+	{
+		xSAR(eax, 31);
+		xSHL(eax, 1);
+		xNOT(eax);
+	}
+	else
+	{
+		xMOV(eax, 0xffffffff);
+	}
+	u8* end2 = JMP8(0);
+
+	x86SetJ8(cont3);
+	if (sign)
+	{
+		xCDQ();
+		xDIV(ecx);
+	}
+	else
+	{
+		xXOR(edx, edx);
+		xUDIV(ecx);
+	}
+
+	if (end1)
+		x86SetJ8(end1);
+	x86SetJ8(end2);
+}
+
+// PDIVW/PDIVUW: words 0 and 2 are divided, results are sign extended into the LO/HI doublewords
+static void recPDIVWord(bool sign)
+{
+	MMI_CHECK_BEGIN();
+
+	int info = eeRecompileCodeXMM(XMMINFO_READS | XMMINFO_READT | XMMINFO_WRITELO | XMMINFO_WRITEHI);
+
+	for (int i = 0; i < 2; i++)
+	{
+		recPDIVLane(info, i * 2, i * 2, sign, false);
+		xPINSR.D(xRegisterSSE(EEREC_LO), eax, i);
+		xPINSR.D(xRegisterSSE(EEREC_HI), edx, i);
+	}
+	xPMOVSX.DQ(xRegisterSSE(EEREC_LO), xRegisterSSE(EEREC_LO));
+	xPMOVSX.DQ(xRegisterSSE(EEREC_HI), xRegisterSSE(EEREC_HI));
+
+	_clearNeededXMMregs();
+
+	if (sign)
+		MMI_CHECK_END(PDIVW);
+	else
+		MMI_CHECK_END(PDIVUW);
+}
+
 ////////////////////////////////////////////////////
 void recPDIVW(void)
 {
-	_deleteEEreg(_Rd_, 0);
-	recCall(Interp::PDIVW);
+	recPDIVWord(true);
 }
 
 ////////////////////////////////////////////////////
 void recPDIVBW(void)
 {
-	_deleteEEreg(_Rd_, 0);
-	recCall(Interp::PDIVBW); //--
+	MMI_CHECK_BEGIN();
+
+	int info = eeRecompileCodeXMM(XMMINFO_READS | XMMINFO_READT | XMMINFO_WRITELO | XMMINFO_WRITEHI);
+
+	for (int i = 0; i < 4; i++)
+	{
+		recPDIVLane(info, i, 0, true, true);
+		xPINSR.D(xRegisterSSE(EEREC_LO), eax, i);
+		xPINSR.D(xRegisterSSE(EEREC_HI), edx, i);
+	}
+
+	_clearNeededXMMregs();
+
+	MMI_CHECK_END(PDIVBW);
 }
 
 ////////////////////////////////////////////////////
@@ -2691,8 +2895,7 @@ void recPMADDUW(void)
 ////////////////////////////////////////////////////
 void recPDIVUW(void)
 {
-	_deleteEEreg(_Rd_, 0);
-	recCall(Interp::PDIVUW);
+	recPDIVWord(false);
 }
 
 ////////////////////////////////////////////////////
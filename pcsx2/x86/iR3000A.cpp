@@ -31,13 +31,17 @@
 #endif
 
 #include "iCore.h"
+#include "RecProfiler.h"
 
 #include "Config.h"
 
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
 #include "common/FileSystem.h"
 #include "common/Path.h"
 
+#include <unordered_map>
+
 using namespace x86Emitter;
 
 extern void psxBREAK();
@@ -57,6 +61,10 @@ static BASEBLOCK* recROM1 = NULL; // also here
 static BASEBLOCK* recROM2 = NULL; // also here
 static BaseBlocks recBlocks;
 static u8* recPtr = NULL;
+
+// Number of times a block is interpreted before it gets compiled, when tiered compilation is enabled.
+static constexpr u8 TIERED_INTERPRET_VISITS = 4;
+static std::unordered_map<u32, u8> s_nBlockVisits;
 u32 psxpc; // recompiler psxpc
 int psxbranch; // set for branch
 u32 g_iopCyclePenalty;
@@ -71,6 +79,18 @@ static u32 s_nEndBlock = 0; // what psxpc the current block ends
 static u32 s_branchTo;
 static bool s_nBlockFF;
 
+// Cycles skipped by fast-forwarding wait loops, per loop. Only the first few loops found get a
+// counter, which is plenty since games tend to sit in a handful of them.
+struct IopWaitLoopSite
+{
+	u32 pc;
+	u64 cycles;
+};
+static constexpr u32 MAX_WAIT_LOOP_SITES = 64;
+static IopWaitLoopSite s_waitLoopSites[MAX_WAIT_LOOP_SITES];
+static u32 s_waitLoopSiteCount = 0;
+static IopWaitLoopSite* s_pCurWaitLoopSite = nullptr;
+
 static u32 s_saveConstRegs[32];
 static u32 s_saveHasConstReg = 0, s_saveFlushedConstReg = 0;
 static EEINST* s_psaveInstInfo = NULL;
@@ -99,6 +119,7 @@ static void iopClearRecLUT(BASEBLOCK* base, int count);
 // =====================================================================================================
 
 static void iopRecRecompile(const u32 startpc);
+static bool iopRecJITCompile(const u32 startpc);
 
 // Recompiled code buffer for EE recompiler dispatchers!
 alignas(__pagesize) static u8 iopRecDispatchers[__pagesize];
@@ -120,7 +141,10 @@ static const void* _DynGen_JITCompile(void)
 {
 	u8* retval = xGetPtr();
 
-	xFastCall((const void*)iopRecRecompile, ptr32[&psxRegs.pc]);
+	// Interpreting a cold block can use up the rest of the IOP's timeslice.
+	xFastCall((const void*)iopRecJITCompile, ptr32[&psxRegs.pc]);
+	xTEST(al, al);
+	xJNZ(iopExitRecompiledCode);
 
 	xMOV(eax, ptr[&psxRegs.pc]);
 	xMOV(ebx, eax);
@@ -192,8 +216,9 @@ static void _DynGen_Dispatchers(void)
 	xFastCall((const void*)recEventTest);
 	iopDispatcherReg = _DynGen_DispatcherReg();
 
-	iopJITCompile = _DynGen_JITCompile();
+	// JITCompile needs the exit point from EnterRecompiledCode.
 	iopEnterRecompiledCode = _DynGen_EnterRecompiledCode();
+	iopJITCompile = _DynGen_JITCompile();
 
 	mode.m_write = false;
 	mode.m_exec  = true;
@@ -814,11 +839,43 @@ static void recAlloc(void)
 	_DynGen_Dispatchers();
 }
 
+static IopWaitLoopSite* iopGetWaitLoopSite(u32 pc)
+{
+	for (u32 i = 0; i < s_waitLoopSiteCount; i++)
+	{
+		if (s_waitLoopSites[i].pc == pc)
+			return &s_waitLoopSites[i];
+	}
+
+	if (s_waitLoopSiteCount == MAX_WAIT_LOOP_SITES)
+		return nullptr;
+
+	IopWaitLoopSite* site = &s_waitLoopSites[s_waitLoopSiteCount++];
+	site->pc = pc;
+	site->cycles = 0;
+	return site;
+}
+
+static void iopResetWaitLoopSites()
+{
+	for (u32 i = 0; i < s_waitLoopSiteCount; i++)
+	{
+		const IopWaitLoopSite& site = s_waitLoopSites[i];
+		if (site.cycles > 0)
+			Console.WriteLn("(IOP WaitLoop) 0x%08x: skipped %llu cycles", site.pc, static_cast<unsigned long long>(site.cycles));
+	}
+
+	s_waitLoopSiteCount = 0;
+	s_pCurWaitLoopSite = nullptr;
+}
+
 void recResetIOP(void)
 {
 	recAlloc();
 	recMem->Reset();
 
+	iopResetWaitLoopSites();
+
 	iopClearRecLUT((BASEBLOCK*)m_recBlockAlloc,
 		(((Ps2MemSize::IopRam + Ps2MemSize::Rom + Ps2MemSize::Rom1 + Ps2MemSize::Rom2) / 4)));
 
@@ -865,6 +922,7 @@ void recResetIOP(void)
 		memset(s_pInstCache, 0, sizeof(EEINST) * s_nInstCacheSize);
 
 	recBlocks.Reset();
+	s_nBlockVisits.clear();
 	g_psxMaxRecMem = 0;
 
 	recPtr = *recMem;
@@ -1046,6 +1104,14 @@ static void iPsxBranchTest(u32 newpc, u32 cpuBranch)
 		xCMOVNS(eax, ptr32[&psxRegs.iopNextEventCycle]);
 		xMOV(ptr32[&psxRegs.cycle], eax);
 		xSUB(eax, ecx);
+		if (s_pCurWaitLoopSite)
+		{
+			// An overdue event moves the cycle count backwards, which isn't a skip.
+			xXOR(ecx, ecx);
+			xTEST(eax, eax);
+			xCMOVNS(ecx, eax);
+			xADD(ptr64[&s_pCurWaitLoopSite->cycles], rcx);
+		}
 		xSHL(eax, 3);
 		xSUB(ptr32[&psxRegs.iopCycleEE], eax);
 		xJLE(iopExitRecompiledCode);
@@ -1154,6 +1220,31 @@ void psxRecompileNextInstruction(bool delayslot, bool swapped_delayslot)
 	}
 }
 
+// Called through iopJITCompile. With tiered compilation, blocks are interpreted for their first
+// few visits so that run-once code never pays for compilation, and compiles them on this thread
+// after that, like recJITCompile. Returns true when the IOP's timeslice has run out and control
+// needs to go back to the EE.
+static bool iopRecJITCompile(const u32 startpc)
+{
+	// PS1 BIOS calls are dispatched at block entry by the recompiler, so they can't be interpreted.
+	const bool bios_call = (psxHu32(HW_ICFG) & 8) && (HWADDR(startpc) == 0xa0 || HWADDR(startpc) == 0xb0 || HWADDR(startpc) == 0xc0);
+	if (EmuConfig.Cpu.Recompiler.EnableTieredCompilation && !bios_call)
+	{
+		u8& visits = s_nBlockVisits[HWADDR(startpc)];
+		if (visits < TIERED_INTERPRET_VISITS)
+		{
+			visits++;
+			psxInterpretBlock();
+			return (psxRegs.iopCycleEE <= 0);
+		}
+
+		s_nBlockVisits.erase(HWADDR(startpc));
+	}
+
+	iopRecRecompile(startpc);
+	return false;
+}
+
 static void iopRecRecompile(const u32 startpc)
 {
 	u32 i;
@@ -1196,6 +1287,10 @@ static void iopRecRecompile(const u32 startpc)
 
 	_initX86regs();
 
+	const bool profile = RecProfiler::IsEnabled();
+	if (profile)
+		RecProfiler::EmitBlockEntry(RecProfiler::Cpu::IOP, startpc);
+
 	if ((psxHu32(HW_ICFG) & 8) && (HWADDR(startpc) == 0xa0 || HWADDR(startpc) == 0xb0 || HWADDR(startpc) == 0xc0))
 	{
 		xFastCall((const void*)psxBiosCall);
@@ -1258,23 +1353,87 @@ static void iopRecRecompile(const u32 startpc)
 
 StartRecomp:
 
+	// Same idea as the EE: a loop which doesn't write to a register it's already read (excepting
+	// registers initialised with constants or memory loads) and doesn't alter any other machine
+	// state does the same thing on every iteration, so it can only exit once an event fires.
+	// This catches IRX modules polling hardware registers or SIF flags.
 	s_nBlockFF = false;
+	s_pCurWaitLoopSite = nullptr;
 	if (s_branchTo == startpc)
 	{
 		s_nBlockFF = true;
+
+		u32 reads = 0, loads = 1;
+
 		for (i = startpc; i < s_nEndBlock; i += 4)
 		{
-			if (i != s_nEndBlock - 8)
+			if (i == s_nEndBlock - 8)
+				continue;
+			psxRegs.code = iopMemRead32(i);
+			const u32 opcode = psxRegs.code >> 26;
+			// nop
+			if (psxRegs.code == 0)
+				continue;
+			// imm arithmetic
+			else if ((opcode & 070) == 010)
 			{
-				switch (iopMemRead32(i))
+				if (loads & 1 << _Rs_)
+				{
+					loads |= 1 << _Rt_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_;
+				if (reads & 1 << _Rt_)
 				{
-					case 0: // nop
-						break;
-					default:
-						s_nBlockFF = false;
+					s_nBlockFF = false;
+					break;
 				}
 			}
+			// common register arithmetic instructions
+			else if (opcode == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
+			{
+				if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
+				{
+					loads |= 1 << _Rd_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_ | 1 << _Rt_;
+				if (reads & 1 << _Rd_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// loads
+			else if ((opcode & 070) == 040)
+			{
+				if (loads & 1 << _Rs_)
+				{
+					loads |= 1 << _Rt_;
+					continue;
+				}
+				else
+					reads |= 1 << _Rs_;
+				if (reads & 1 << _Rt_)
+				{
+					s_nBlockFF = false;
+					break;
+				}
+			}
+			// mfc*, cfc*
+			else if ((opcode & 074) == 020 && _Rs_ < 4)
+				loads |= 1 << _Rt_;
+			else
+			{
+				s_nBlockFF = false;
+				break;
+			}
 		}
+
+		if (s_nBlockFF)
+			s_pCurWaitLoopSite = iopGetWaitLoopSite(startpc);
 	}
 
 	// rec info //
@@ -1340,6 +1499,9 @@ StartRecomp:
 
 	s_pCurBlockEx->x86size = xGetPtr() - recPtr;
 
+	if (profile)
+		RecProfiler::RegisterBlock(RecProfiler::Cpu::IOP, startpc, s_pCurBlockEx->size, recPtr, s_pCurBlockEx->x86size);
+
 	recPtr = xGetPtr();
 
 	s_pCurBlock = NULL;
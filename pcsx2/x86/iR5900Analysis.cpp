@@ -17,6 +17,9 @@
 #include "Memory.h"
 #include "Config.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 using namespace R5900;
 
 // This should be moved to analysis...
@@ -291,6 +294,297 @@ void COP2MicroFinishPass::Run(u32 start, u32 end, EEINST* inst_cache)
 	});
 }
 
+LoopIdiomPass::LoopIdiomPass() = default;
+
+LoopIdiomPass::~LoopIdiomPass() = default;
+
+void LoopIdiomPass::Run(u32 start, u32 end, EEINST* inst_cache)
+{
+	static constexpr u32 NONE = 0xffffffffu;
+
+	enum class Branch
+	{
+		None,
+		BEQ,
+		BNE,
+		BLEZ,
+		BGTZ,
+		BLTZ,
+		BGEZ,
+	};
+
+	struct Access
+	{
+		u32 pos;
+		u32 reg;
+		u32 base;
+		s16 offset;
+		u8 width;
+	};
+
+	struct Compare
+	{
+		u32 pos;
+		u32 rd;
+		u32 rs;
+		u32 rt;
+		bool imm;
+		bool is_unsigned;
+		s64 bound;
+	};
+
+	m_found = false;
+	m_idiom = {};
+
+	Access load = {NONE};
+	Access store = {NONE};
+	Compare slt = {NONE};
+	Branch branch = Branch::None;
+	u32 branch_pos = NONE, branch_rs = 0, branch_rt = 0;
+	u32 counter_pos[32];
+	std::fill(std::begin(counter_pos), std::end(counter_pos), NONE);
+
+	// Every register may only be written once, so anything the loop doesn't write is invariant.
+	u32 written = 0;
+	bool valid = true;
+	const auto write = [&written, &valid](u32 reg) {
+		if (reg == 0 || (written & (1u << reg)))
+			valid = false;
+		written |= 1u << reg;
+	};
+
+	ForEachInstruction(start, end, inst_cache, [&](u32 apc, EEINST*) {
+		const u32 pos = (apc - start) / 4;
+		if (cpuRegs.code == 0)
+			return true;
+
+		u8 load_width = 0, store_width = 0;
+		switch (_Opcode_)
+		{
+			case 011: // ADDIU
+			case 031: // DADDIU
+				if (_Rs_ != _Rt_ || _Imm_ == 0 || m_idiom.num_counters == LoopIdiom::MAX_COUNTERS)
+					return (valid = false);
+				write(_Rt_);
+				counter_pos[_Rt_] = pos;
+				m_idiom.counters[m_idiom.num_counters++] = {static_cast<u8>(_Rt_), _Opcode_ == 031, _Imm_};
+				return valid;
+
+			case 040: // LB
+			case 044: // LBU
+				load_width = 1;
+				break;
+			case 041: // LH
+			case 045: // LHU
+				load_width = 2;
+				break;
+			case 043: // LW
+			case 047: // LWU
+				load_width = 4;
+				break;
+			case 067: // LD
+				load_width = 8;
+				break;
+			case 036: // LQ
+				load_width = 16;
+				break;
+
+			case 050: // SB
+				store_width = 1;
+				break;
+			case 051: // SH
+				store_width = 2;
+				break;
+			case 053: // SW
+				store_width = 4;
+				break;
+			case 077: // SD
+				store_width = 8;
+				break;
+			case 037: // SQ
+				store_width = 16;
+				break;
+
+			case 012: // SLTI
+			case 013: // SLTIU
+			case 000: // SLT, SLTU
+				if ((_Opcode_ == 000 && _Funct_ != 052 && _Funct_ != 053) || slt.pos != NONE)
+					return (valid = false);
+				if (_Opcode_ == 000)
+				{
+					slt = {pos, _Rd_, _Rs_, _Rt_, false, _Funct_ == 053, 0};
+					write(_Rd_);
+				}
+				else
+				{
+					slt = {pos, _Rt_, _Rs_, 0, true, _Opcode_ == 013, _Imm_};
+					write(_Rt_);
+				}
+				return valid;
+
+			case 001: // BLTZ, BGEZ
+			case 004: // BEQ
+			case 005: // BNE
+			case 006: // BLEZ
+			case 007: // BGTZ
+				if (branch != Branch::None || pos != (end - start) / 4 - 2 || apc + 4 + _Imm_ * 4 != start)
+					return (valid = false);
+				if (_Opcode_ == 001)
+				{
+					if (_Rt_ > 1)
+						return (valid = false);
+					branch = (_Rt_ == 0) ? Branch::BLTZ : Branch::BGEZ;
+				}
+				else
+				{
+					static constexpr Branch branches[] = {Branch::BEQ, Branch::BNE, Branch::BLEZ, Branch::BGTZ};
+					branch = branches[_Opcode_ - 004];
+				}
+				branch_pos = pos;
+				branch_rs = _Rs_;
+				branch_rt = (branch == Branch::BEQ || branch == Branch::BNE) ? _Rt_ : 0;
+				return true;
+
+			default:
+				return (valid = false);
+		}
+
+		Access& access = load_width ? load : store;
+		if (access.pos != NONE)
+			return (valid = false);
+		access = {pos, _Rt_, _Rs_, _Imm_, static_cast<u8>(load_width | store_width)};
+		if (load_width)
+			write(_Rt_);
+		return valid;
+	});
+
+	if (!valid || branch == Branch::None || store.pos == NONE)
+		return;
+
+	const auto find_counter = [this](u32 reg) {
+		for (u32 i = 0; i < m_idiom.num_counters; i++)
+		{
+			if (m_idiom.counters[i].reg == reg)
+				return i;
+		}
+		return NONE;
+	};
+	const auto invariant = [written](u32 reg) { return (written & (1u << reg)) == 0; };
+	const auto use = [&counter_pos, &find_counter](u32 reg, u32 pos, s16 offset) {
+		return LoopIdiom::CounterUse{static_cast<u8>(find_counter(reg)), counter_pos[reg] < pos, offset};
+	};
+
+	// The store walks through memory one element at a time.
+	const u32 store_counter = find_counter(store.base);
+	if (store_counter == NONE || std::abs(m_idiom.counters[store_counter].stride) != store.width)
+		return;
+
+	m_idiom.width = store.width;
+	m_idiom.store = use(store.base, store.pos, store.offset);
+
+	if (load.pos != NONE)
+	{
+		// A copy stores what it loaded in the same iteration, in the same direction, and the loaded
+		// value isn't used for anything else.
+		const u32 load_counter = find_counter(load.base);
+		if (load_counter == NONE || load.pos > store.pos || load.reg != store.reg || load.width != store.width ||
+			m_idiom.counters[load_counter].stride != m_idiom.counters[store_counter].stride ||
+			load.reg == branch_rs || load.reg == branch_rt ||
+			(slt.pos != NONE && (load.reg == slt.rs || (!slt.imm && load.reg == slt.rt))))
+		{
+			return;
+		}
+
+		m_idiom.kind = LoopIdiom::Kind::Copy;
+		m_idiom.load = use(load.base, load.pos, load.offset);
+	}
+	else
+	{
+		if (!invariant(store.reg))
+			return;
+
+		m_idiom.kind = LoopIdiom::Kind::Fill;
+		m_idiom.fill_reg = static_cast<u8>(store.reg);
+	}
+
+	// The exit has to compare a counter against something invariant.
+	u32 exit_reg, exit_pos;
+	if (branch == Branch::BEQ || branch == Branch::BNE)
+	{
+		if (slt.pos != NONE)
+		{
+			if (slt.pos > branch_pos || !((branch_rs == slt.rd && branch_rt == 0) || (branch_rt == slt.rd && branch_rs == 0)))
+				return;
+
+			if (find_counter(slt.rs) != NONE && (slt.imm || invariant(slt.rt)))
+			{
+				m_idiom.exit = (branch == Branch::BNE) ? LoopIdiom::Exit::Less : LoopIdiom::Exit::GreaterEqual;
+				exit_reg = slt.rs;
+				m_idiom.bound_reg = static_cast<u8>(slt.rt);
+				m_idiom.bound_imm = slt.bound;
+			}
+			else if (!slt.imm && find_counter(slt.rt) != NONE && invariant(slt.rs))
+			{
+				m_idiom.exit = (branch == Branch::BNE) ? LoopIdiom::Exit::Greater : LoopIdiom::Exit::LessEqual;
+				exit_reg = slt.rt;
+				m_idiom.bound_reg = static_cast<u8>(slt.rs);
+			}
+			else
+			{
+				return;
+			}
+
+			m_idiom.exit_unsigned = slt.is_unsigned;
+			exit_pos = slt.pos;
+		}
+		else
+		{
+			if (branch != Branch::BNE)
+				return;
+
+			if (find_counter(branch_rs) != NONE && invariant(branch_rt))
+			{
+				exit_reg = branch_rs;
+				m_idiom.bound_reg = static_cast<u8>(branch_rt);
+			}
+			else if (find_counter(branch_rt) != NONE && invariant(branch_rs))
+			{
+				exit_reg = branch_rt;
+				m_idiom.bound_reg = static_cast<u8>(branch_rs);
+			}
+			else
+			{
+				return;
+			}
+
+			m_idiom.exit = LoopIdiom::Exit::NotEqual;
+			exit_pos = branch_pos;
+		}
+	}
+	else
+	{
+		if (slt.pos != NONE || find_counter(branch_rs) == NONE)
+			return;
+
+		static constexpr LoopIdiom::Exit exits[] = {LoopIdiom::Exit::LessEqual, LoopIdiom::Exit::Greater,
+			LoopIdiom::Exit::Less, LoopIdiom::Exit::GreaterEqual};
+		m_idiom.exit = exits[static_cast<int>(branch) - static_cast<int>(Branch::BLEZ)];
+		exit_reg = branch_rs;
+		exit_pos = branch_pos;
+	}
+
+	// A counter moving away from its bound only stops when it wraps around.
+	const s16 exit_stride = m_idiom.counters[find_counter(exit_reg)].stride;
+	if (((m_idiom.exit == LoopIdiom::Exit::Less || m_idiom.exit == LoopIdiom::Exit::LessEqual) && exit_stride < 0) ||
+		((m_idiom.exit == LoopIdiom::Exit::Greater || m_idiom.exit == LoopIdiom::Exit::GreaterEqual) && exit_stride > 0))
+	{
+		return;
+	}
+
+	m_idiom.exit_counter = use(exit_reg, exit_pos, 0);
+	m_found = true;
+}
+
 /////////////////////////////////////////////////////////////////////
 // Back-Prop Function Tables - Gathering Info
 // Note to anyone changing these: writes must go before reads.
@@ -65,6 +65,77 @@ namespace R5900
 
 		void Run(u32 start, u32 end, EEINST* inst_cache) override;
 	};
+
+	/// A self-loop which copies or fills memory one element per iteration, with a trip count that
+	/// can be worked out from the registers on entry.
+	struct LoopIdiom
+	{
+		static constexpr u32 MAX_COUNTERS = 4;
+
+		enum class Kind : u8
+		{
+			Copy,
+			Fill,
+		};
+
+		/// How the exit counter is compared against the bound, the loop continues while it holds.
+		enum class Exit : u8
+		{
+			NotEqual,
+			Less,
+			LessEqual,
+			Greater,
+			GreaterEqual,
+		};
+
+		/// A register stepped by a constant once per iteration, with ADDIU or DADDIU.
+		struct Counter
+		{
+			u8 reg;
+			bool wide;
+			s16 stride;
+		};
+
+		/// A use of a counter, and whether the counter was already stepped in this iteration when it's read.
+		struct CounterUse
+		{
+			u8 counter;
+			bool stepped;
+			s16 offset;
+		};
+
+		Counter counters[MAX_COUNTERS];
+		u32 num_counters;
+
+		Kind kind;
+		u8 width; // bytes per load/store
+		u8 fill_reg; // the register stored by a fill
+		CounterUse load;
+		CounterUse store;
+
+		Exit exit;
+		bool exit_unsigned;
+		CounterUse exit_counter;
+		u8 bound_reg; // bound_imm is used when this is zero
+		s64 bound_imm;
+	};
+
+	class LoopIdiomPass final : public AnalysisPass
+	{
+	public:
+		LoopIdiomPass();
+		~LoopIdiomPass();
+
+		/// Expects a block which ends with a branch back to start and its delay slot.
+		void Run(u32 start, u32 end, EEINST* inst_cache) override;
+
+		bool Found() const { return m_found; }
+		const LoopIdiom& GetIdiom() const { return m_idiom; }
+
+	private:
+		bool m_found = false;
+		LoopIdiom m_idiom = {};
+	};
 } // namespace R5900
 
 void recBackpropBSC(u32 code, EEINST* prev, EEINST* pinst);
@@ -29,10 +29,13 @@
 #include "x86/BaseblockEx.h"
 #include "x86/iR5900.h"
 #include "x86/iR5900Analysis.h"
+#include "x86/RecProfiler.h"
 
 #include "common/AlignedMalloc.h"
 #include "common/FastJmp.h"
 
+#include <unordered_map>
+
 // Only for MOVQ workaround.
 #include "common/emitter/internal.h"
 
@@ -94,6 +97,34 @@ static EEINST* s_psaveInstInfo = NULL;
 
 static u32 s_savenBlockCycles = 0;
 
+// Self-looping blocks can keep the GPRs they read in host registers across the back edge.
+struct LoopCarryReg
+{
+	u8 gpr;
+	u8 x86reg;
+};
+static constexpr u32 LOOP_CARRY_MAX_REGS = 4;
+static LoopCarryReg s_loopCarry[LOOP_CARRY_MAX_REGS];
+static u32 s_loopCarryCount = 0;
+static u8* s_loopHeader = NULL; // where the back edge jumps to, NULL if the block doesn't carry registers
+
+// Self-looping blocks which copy or fill memory call out to run most of their iterations in bulk.
+struct LoopIdiomBlock
+{
+	LoopIdiom idiom;
+	uptr code_page; // host page holding the loop itself, which is never stored to in bulk
+	u32 cycles; // added by every iteration, set once the body is compiled
+	u8 misses; // entries in a row where the memory couldn't be accessed directly
+	bool disabled; // checked by the block before calling in
+};
+static constexpr u8 LOOP_IDIOM_MAX_MISSES = 64;
+// Keyed by start pc, so recompiling a block reuses its entry. Blocks point into this, so it's only cleared with the code cache.
+static std::unordered_map<u32, LoopIdiomBlock> s_loopIdioms;
+
+// Number of times a block is interpreted before it gets compiled, when tiered compilation is enabled.
+static constexpr u8 TIERED_INTERPRET_VISITS = 4;
+static std::unordered_map<u32, u8> s_nBlockVisits;
+
 static void iBranchTest(u32 newpc);
 static void ClearRecLUT(BASEBLOCK* base, int count);
 static u32 scaleblockcycles(void);
@@ -221,6 +252,7 @@ void recCall(void (*func)())
 // =====================================================================================================
 
 static void recRecompile(const u32 startpc);
+static void recJITCompile(const u32 startpc);
 static void dyna_block_discard(u32 start, u32 sz);
 static void dyna_page_reset(u32 start, u32 sz);
 
@@ -315,7 +347,7 @@ static const void* _DynGen_JITCompile(void)
 {
 	u8* retval = xGetAlignedCallTarget();
 
-	xFastCall((const void*)recRecompile, ptr32[&cpuRegs.pc]);
+	xFastCall((const void*)recJITCompile, ptr32[&cpuRegs.pc]);
 
 	// C equivalent:
 	// u32 addr = cpuRegs.pc;
@@ -535,6 +567,8 @@ static void recResetRaw(void)
 		memset(s_pInstCache, 0, sizeof(EEINST) * s_nInstCacheSize);
 
 	recBlocks.Reset();
+	s_nBlockVisits.clear();
+	s_loopIdioms.clear();
 	mmap_ResetBlockTracking();
 	vtlb_ClearLoadStoreInfo();
 
@@ -556,6 +590,7 @@ static void recShutdown(void)
 	safe_aligned_free(recLutReserve_RAM);
 
 	recBlocks.Reset();
+	s_loopIdioms.clear();
 
 	recRAM = recROM = recROM1 = recROM2 = NULL;
 
@@ -707,10 +742,18 @@ void SetBranchReg(u32 reg)
 	iBranchTest(0xffffffff);
 }
 
+static void recLoopCarryBackEdge(u32 imm);
+
 void SetBranchImm(u32 imm)
 {
 	g_branch = 1;
 
+	if (s_loopHeader && HWADDR(imm) == s_pCurBlockEx->startpc)
+	{
+		recLoopCarryBackEdge(imm);
+		return;
+	}
+
 	// end the current block
 	iFlushCall(FLUSH_EVERYTHING);
 	xMOV(ptr32[&cpuRegs.pc], imm);
@@ -1622,6 +1665,423 @@ static bool recSkipTimeoutLoop(s32 reg, bool is_timeout_loop)
 	return true;
 }
 
+// Steps a counter the way its ADDIU/DADDIU would, the given number of times.
+static u64 recLoopIdiomStep(const LoopIdiom::Counter& counter, u64 value, u64 steps)
+{
+	const u64 delta = steps * static_cast<u64>(static_cast<s64>(counter.stride));
+	if (counter.wide)
+		return value + delta;
+	return static_cast<u64>(static_cast<s64>(static_cast<s32>(static_cast<u32>(value + delta))));
+}
+
+// The value a counter is read at in the given iteration from now.
+static u64 recLoopIdiomCounterAt(const LoopIdiom& idiom, const LoopIdiom::CounterUse& use, u64 iteration)
+{
+	const LoopIdiom::Counter& counter = idiom.counters[use.counter];
+	return recLoopIdiomStep(counter, cpuRegs.GPR.r[counter.reg].UD[0], iteration + (use.stepped ? 1 : 0));
+}
+
+// Returns how many iterations from here on certainly branch back, or zero if that can't be worked out.
+static u64 recLoopIdiomTrips(const LoopIdiom& idiom)
+{
+	const LoopIdiom::Counter& counter = idiom.counters[idiom.exit_counter.counter];
+	const u64 value = cpuRegs.GPR.r[counter.reg].UD[0];
+	if (!counter.wide && value != static_cast<u64>(static_cast<s64>(static_cast<s32>(value))))
+		return 0;
+
+	const u64 first = recLoopIdiomCounterAt(idiom, idiom.exit_counter, 0);
+	const u64 bound = idiom.bound_reg ? cpuRegs.GPR.r[idiom.bound_reg].UD[0] : static_cast<u64>(idiom.bound_imm);
+	const u64 step = static_cast<u64>(std::abs(counter.stride));
+	const bool up = counter.stride > 0;
+
+	if (idiom.exit == LoopIdiom::Exit::NotEqual)
+	{
+		// Runs until the counter lands on the bound, wrapping around if it has to.
+		if (!counter.wide && bound != static_cast<u64>(static_cast<s64>(static_cast<s32>(bound))))
+			return 0;
+
+		u64 distance = up ? (bound - first) : (first - bound);
+		if (!counter.wide)
+			distance = static_cast<u32>(distance);
+		return (distance % step == 0) ? (distance / step) : 0;
+	}
+
+	const auto less = [&idiom](u64 a, u64 b) {
+		return idiom.exit_unsigned ? (a < b) : (static_cast<s64>(a) < static_cast<s64>(b));
+	};
+
+	u64 trips = 0;
+	switch (idiom.exit)
+	{
+		case LoopIdiom::Exit::Less:
+			if (!less(first, bound))
+				return 0;
+			trips = (bound - first) / step + (((bound - first) % step) ? 1 : 0);
+			break;
+		case LoopIdiom::Exit::LessEqual:
+			if (less(bound, first))
+				return 0;
+			trips = (bound - first) / step + 1;
+			break;
+		case LoopIdiom::Exit::Greater:
+			if (!less(bound, first))
+				return 0;
+			trips = (first - bound) / step + (((first - bound) % step) ? 1 : 0);
+			break;
+		case LoopIdiom::Exit::GreaterEqual:
+			if (less(first, bound))
+				return 0;
+			trips = (first - bound) / step + 1;
+			break;
+		default:
+			return 0;
+	}
+
+	// The comparison only sees the counter moving steadily until it wraps around, so the counter
+	// has to reach the value it exits at before then.
+	u64 limit;
+	if (counter.wide)
+		limit = idiom.exit_unsigned ? (up ? UINT64_MAX : 0) : static_cast<u64>(up ? INT64_MAX : INT64_MIN);
+	else if (!idiom.exit_unsigned)
+		limit = static_cast<u64>(static_cast<s64>(up ? INT32_MAX : INT32_MIN));
+	else if (static_cast<s64>(first) >= 0)
+		limit = up ? INT32_MAX : 0;
+	else
+		limit = up ? UINT64_MAX : static_cast<u64>(static_cast<s64>(INT32_MIN));
+
+	const u64 room = up ? (limit - first) : (first - limit);
+	return (trips <= room / step) ? trips : 0;
+}
+
+// Host pointer for a guest address, or nullptr if the page goes through a handler.
+static u8* recLoopIdiomHostPtr(u32 addr)
+{
+	const vtlb_private::VTLBVirtual& vmv = vtlb_private::vtlbdata.vmap[addr >> vtlb_private::VTLB_PAGE_BITS];
+	return vmv.isHandler(addr) ? nullptr : reinterpret_cast<u8*>(vmv.assumePtr(addr));
+}
+
+// Elements left in the page from addr, in the direction the loop walks.
+static u64 recLoopIdiomPageElements(u32 addr, bool up, u32 width)
+{
+	const u32 offset = addr & vtlb_private::VTLB_PAGE_MASK;
+	return up ? ((vtlb_private::VTLB_PAGE_SIZE - offset) / width) : (offset / width + 1);
+}
+
+// Runs the loads and stores of up to the given number of iterations, a page at a time, and returns
+// how many were done before reaching memory which has to go through vtlb handlers.
+static u64 recLoopIdiomMemory(const LoopIdiomBlock& block, u64 iterations)
+{
+	const LoopIdiom& idiom = block.idiom;
+	const u32 width = idiom.width;
+	const bool up = idiom.counters[idiom.store.counter].stride > 0;
+	const u8* fill = cpuRegs.GPR.r[idiom.fill_reg].UC;
+	const bool fill_bytes = std::all_of(fill + 1, fill + width, [fill](u8 b) { return b == fill[0]; });
+
+	u64 done = 0;
+	while (done < iterations)
+	{
+		const u32 dst_addr = static_cast<u32>(recLoopIdiomCounterAt(idiom, idiom.store, done)) + idiom.store.offset;
+		u8* const dst = recLoopIdiomHostPtr(dst_addr);
+		if ((dst_addr & (width - 1)) != 0 || !dst ||
+			(reinterpret_cast<uptr>(dst) & ~static_cast<uptr>(vtlb_private::VTLB_PAGE_MASK)) == block.code_page)
+		{
+			break;
+		}
+
+		u64 count = std::min(iterations - done, recLoopIdiomPageElements(dst_addr, up, width));
+		const sptr stride = up ? static_cast<sptr>(width) : -static_cast<sptr>(width);
+
+		if (idiom.kind == LoopIdiom::Kind::Copy)
+		{
+			const u32 src_addr = static_cast<u32>(recLoopIdiomCounterAt(idiom, idiom.load, done)) + idiom.load.offset;
+			const u8* const src = recLoopIdiomHostPtr(src_addr);
+			if ((src_addr & (width - 1)) != 0 || !src)
+				break;
+
+			count = std::min(count, recLoopIdiomPageElements(src_addr, up, width));
+			const size_t bytes = static_cast<size_t>(count) * width;
+			u8* const dst_low = up ? dst : (dst - (bytes - width));
+			const u8* const src_low = up ? src : (src - (bytes - width));
+
+			// Element by element, an earlier store can feed a later load when the destination is ahead.
+			if (dst_low + bytes <= src_low || src_low + bytes <= dst_low)
+				std::memcpy(dst_low, src_low, bytes);
+			else if (up ? (dst <= src) : (dst >= src))
+				std::memmove(dst_low, src_low, bytes);
+			else
+			{
+				for (u64 i = 0; i < count; i++)
+				{
+					u8 element[16];
+					std::memcpy(element, src + static_cast<sptr>(i) * stride, width);
+					std::memcpy(dst + static_cast<sptr>(i) * stride, element, width);
+				}
+			}
+		}
+		else
+		{
+			const size_t bytes = static_cast<size_t>(count) * width;
+			u8* const dst_low = up ? dst : (dst - (bytes - width));
+			if (fill_bytes)
+				std::memset(dst_low, fill[0], bytes);
+			else
+			{
+				for (size_t offset = 0; offset < bytes; offset += width)
+					std::memcpy(dst_low + offset, fill, width);
+			}
+		}
+
+		done += count;
+	}
+
+	return done;
+}
+
+// Called at the start of a copy/fill loop with the guest registers in memory. Runs every iteration
+// which branches back and finishes before the next event in bulk, leaving the rest to the block, so
+// it leaves with the registers and cycle count it would have had anyway.
+static void recLoopIdiomRun(LoopIdiomBlock* block)
+{
+	const LoopIdiom& idiom = block->idiom;
+
+	u64 iterations = recLoopIdiomTrips(idiom);
+	if (block->cycles != 0)
+	{
+		const s32 until_event = static_cast<s32>(cpuRegs.nextEventCycle - cpuRegs.cycle);
+		iterations = (until_event > 0) ? std::min<u64>(iterations, static_cast<u32>(until_event - 1) / block->cycles) : 0;
+	}
+	if (iterations == 0)
+		return;
+
+	const u64 done = recLoopIdiomMemory(*block, iterations);
+	if (done == 0)
+	{
+		// Loops which keep storing to hardware registers stop calling in.
+		block->disabled = (++block->misses >= LOOP_IDIOM_MAX_MISSES);
+		return;
+	}
+
+	block->misses = 0;
+	for (u32 i = 0; i < idiom.num_counters; i++)
+	{
+		const LoopIdiom::Counter& counter = idiom.counters[i];
+		cpuRegs.GPR.r[counter.reg].UD[0] = recLoopIdiomStep(counter, cpuRegs.GPR.r[counter.reg].UD[0], done);
+	}
+	cpuRegs.cycle += static_cast<u32>(done * block->cycles);
+}
+
+// Looks for a copy/fill loop, and emits the call to run it in bulk at the start of the block.
+static LoopIdiomBlock* recLoopIdiomBegin(const u32 startpc, bool has_cop2_instructions)
+{
+	if (!EmuConfig.Cpu.Recompiler.EnableEELoopIdioms || s_branchTo != startpc || has_cop2_instructions || CHECK_CACHE)
+		return nullptr;
+
+	LoopIdiomPass pass;
+	pass.Run(startpc, s_nEndBlock, s_pInstCache + 1);
+	if (!pass.Found())
+		return nullptr;
+
+	LoopIdiomBlock& block = s_loopIdioms[startpc];
+	block = {};
+	block.idiom = pass.GetIdiom();
+	block.code_page = reinterpret_cast<uptr>(PSM(startpc)) & ~static_cast<uptr>(vtlb_private::VTLB_PAGE_MASK);
+
+	xLoadFarAddr(arg1reg, &block);
+	xCMP(ptr8[arg1reg + offsetof(LoopIdiomBlock, disabled)], 0);
+	xForwardJNZ8 skip;
+	xFastCall((const void*)recLoopIdiomRun, arg1reg);
+	skip.SetTarget();
+	return &block;
+}
+
+static bool recCanCarryLoopRegisters(const u32 startpc, bool has_cop2_instructions)
+{
+	if (!EmuConfig.Cpu.Recompiler.EnableEELoopRegisterCarry || s_branchTo != startpc || has_cop2_instructions)
+		return false;
+
+	// Idle loops already skip ahead to the next event.
+	if (EmuConfig.Speedhacks.WaitLoop && s_nBlockFF)
+		return false;
+
+	// Anything emitted before the body (hooks, manual protection checks) has to run on every iteration.
+	return xGetPtr() == recPtr;
+}
+
+// Loads the GPRs the loop reads before writing into callee saved registers, and marks the loop header.
+// The back edge brings the same registers up to date and jumps to the header, instead of flushing
+// everything and reloading it through the block link.
+static void recLoopCarryBegin(const u32 startpc)
+{
+	const u32 numinsts = (s_nEndBlock - startpc) / 4;
+	u32 reads[32] = {};
+
+	for (u32 gpr = 1; gpr < 32; gpr++)
+	{
+		const u8 entry = s_pInstCache[0].regs[gpr];
+		if ((entry & (EEINST_LIVE | EEINST_USED | EEINST_XMM)) != (EEINST_LIVE | EEINST_USED))
+			continue;
+
+		for (u32 i = 1; i <= numinsts; i++)
+		{
+			const EEINST& inst = s_pInstCache[i];
+			if (inst.regs[gpr] & EEINST_XMM)
+			{
+				reads[gpr] = 0;
+				break;
+			}
+
+			for (u32 j = 0; j < std::size(inst.readType); j++)
+			{
+				if (inst.readType[j] == X86TYPE_GPR && inst.readReg[j] == gpr)
+					reads[gpr]++;
+			}
+		}
+	}
+
+	s_loopCarryCount = 0;
+	while (s_loopCarryCount < LOOP_CARRY_MAX_REGS)
+	{
+		u32 best = 0;
+		for (u32 gpr = 1; gpr < 32; gpr++)
+		{
+			if (reads[gpr] > reads[best])
+				best = gpr;
+		}
+		if (best == 0)
+			break;
+
+		reads[best] = 0;
+		const int x86reg = _allocX86reg(X86TYPE_GPR, best, MODE_READ | MODE_CALLEESAVED);
+		s_loopCarry[s_loopCarryCount++] = {static_cast<u8>(best), static_cast<u8>(x86reg)};
+	}
+
+	_clearNeededX86regs();
+	s_loopHeader = s_loopCarryCount ? xGetPtr() : NULL;
+}
+
+static void recLoopCarryBackEdge(u32 imm)
+{
+	const auto carried_x86reg = [](u32 gpr) {
+		for (u32 i = 0; i < s_loopCarryCount; i++)
+		{
+			if (s_loopCarry[i].gpr == gpr)
+				return static_cast<int>(s_loopCarry[i].x86reg);
+		}
+		return -1;
+	};
+
+	// Everything which isn't carried goes back to memory, like FLUSH_EVERYTHING.
+	// Carried registers are clean at the header, so exits don't have to write them.
+	for (u32 i = 0; i < iREGCNT_XMM; i++)
+	{
+		if (xmmregs[i].inuse)
+			_freeXMMreg(i);
+	}
+
+	for (u32 i = 0; i < iREGCNT_GPR; i++)
+	{
+		if (!x86regs[i].inuse)
+			continue;
+
+		if (x86regs[i].type == X86TYPE_GPR && carried_x86reg(x86regs[i].reg) == static_cast<int>(i))
+		{
+			if (x86regs[i].mode & MODE_WRITE)
+				_writebackX86Reg(i);
+			x86regs[i].mode = MODE_READ;
+			continue;
+		}
+
+		_freeX86reg(i);
+	}
+
+	_flushConstRegs();
+
+	for (u32 i = 0; i < s_loopCarryCount; i++)
+	{
+		const LoopCarryReg& carry = s_loopCarry[i];
+		if (x86regs[carry.x86reg].inuse)
+			continue;
+
+		if (GPR_IS_CONST1(carry.gpr))
+			xMOV64(xRegister64(carry.x86reg), g_cpuConstRegs[carry.gpr].SD[0]);
+		else
+			xMOV(xRegister64(carry.x86reg), ptr64[&cpuRegs.GPR.r[carry.gpr].UD[0]]);
+	}
+
+	xMOV(ptr32[&cpuRegs.pc], imm);
+
+	// Same event test as iBranchTest, but the block itself is the branch target.
+	xMOV(eax, ptr[&cpuRegs.cycle]);
+	xADD(eax, scaleblockcycles());
+	xMOV(ptr[&cpuRegs.cycle], eax);
+	xSUB(eax, ptr[&cpuRegs.nextEventCycle]);
+	xForwardJNS32 event;
+
+	// The block may have been cleared by a write to its own code, which would have reset its link.
+	xMOV64(rcx, reinterpret_cast<sptr>(&s_pCurBlock->m_pFnptr));
+	xMOV64(rax, reinterpret_cast<sptr>(recPtr));
+	xCMP(ptr64[rcx], rax);
+	xJccKnownTarget(Jcc_Equal, s_loopHeader, false);
+	xJMP((const void*)DispatcherReg);
+
+	event.SetTarget();
+	xJMP((const void*)DispatcherEvent);
+
+	for (u32 i = 0; i < s_loopCarryCount; i++)
+		_freeX86regWithoutWriteback(s_loopCarry[i].x86reg);
+}
+
+static bool recCanInterpretBlock(const u32 startpc)
+{
+	// The BIOS/ELF entry hooks, dynamic patches and a few gamefixes are applied while compiling,
+	// so anything which depends on them has to go straight to the recompiler.
+	if (!g_GameStarted || CHECK_CACHE || CHECK_SKIPMPEGHACK || EmuConfig.Gamefixes.GoemonTlbHack)
+		return false;
+
+	if (EmuConfig.EnablePatches && HasDynamicPatches())
+		return false;
+
+	// Games can rerun EELOAD through LoadExecPS2() to boot another ELF, and the hooks which reload
+	// the ELF info, patches and launch arguments are only emitted by the recompiler.
+	const u32 hwpc = HWADDR(startpc);
+	if (hwpc == EELOAD_START || (g_eeloadMain && hwpc == HWADDR(g_eeloadMain)) || (g_eeloadExec && hwpc == HWADDR(g_eeloadExec)))
+		return false;
+
+	return hwpc != ElfEntry;
+}
+
+// Called through JITCompile. With tiered compilation, blocks are interpreted for their first few
+// visits so that run-once code (loaders, init routines) never pays for compilation. Since the
+// interpreter always reads the current code, invalidation needs no extra handling here.
+// Blocks which stay in use are still compiled here, on the EE thread. Compiling them in the
+// background would need the per-compile state in iCore/iR5900 and the block manager made safe
+// to use alongside recClear first.
+static void recJITCompile(const u32 startpc)
+{
+	if (EmuConfig.Cpu.Recompiler.EnableTieredCompilation && recCanInterpretBlock(startpc))
+	{
+		u8& visits = s_nBlockVisits[HWADDR(startpc)];
+		if (visits < TIERED_INTERPRET_VISITS)
+		{
+			visits++;
+			intInterpretBlock();
+
+			// Events were already tested on the taken branch, but exit requests still need handling.
+			if (eeRecExitRequested)
+			{
+				eeRecExitRequested = false;
+				fastjmp_jmp(&m_SetJmp_StateCheck, 1);
+			}
+
+			return;
+		}
+
+		s_nBlockVisits.erase(HWADDR(startpc));
+	}
+
+	recRecompile(startpc);
+}
+
 static void recRecompile(const u32 startpc)
 {
 	u32 i = 0;
@@ -1646,6 +2106,10 @@ static void recRecompile(const u32 startpc)
 
 	s_pCurBlockEx = recBlocks.New(HWADDR(startpc), (uptr)recPtr);
 
+	const bool profile = RecProfiler::IsEnabled();
+	if (profile)
+		RecProfiler::EmitBlockEntry(RecProfiler::Cpu::EE, startpc);
+
 	if (HWADDR(startpc) == EELOAD_START)
 	{
 		// The EELOAD _start function is the same across all BIOS versions
@@ -1985,8 +2449,13 @@ StartRecomp:
 	{
 		// Finally: Generate x86 recompiled code!
 		g_pCurInstInfo = s_pInstCache;
+		LoopIdiomBlock* loop_idiom = recLoopIdiomBegin(startpc, has_cop2_instructions);
+		if (recCanCarryLoopRegisters(startpc, has_cop2_instructions))
+			recLoopCarryBegin(startpc);
 		while (!g_branch && pc < s_nEndBlock)
 			recompileNextInstruction(false, false); // For the love of recursion, batman!
+		if (loop_idiom)
+			loop_idiom->cycles = scaleblockcycles();
 	}
 
 	s_pCurBlockEx->size = (pc - startpc) >> 2;
@@ -2034,10 +2503,14 @@ StartRecomp:
 
 	s_pCurBlockEx->x86size = static_cast<u32>(xGetPtr() - recPtr);
 
+	if (profile)
+		RecProfiler::RegisterBlock(RecProfiler::Cpu::EE, startpc, s_pCurBlockEx->size, recPtr, s_pCurBlockEx->x86size);
+
 	recPtr = xGetPtr();
 
 	s_pCurBlock = NULL;
 	s_pCurBlockEx = NULL;
+	s_loopHeader = NULL;
 }
 
 R5900cpu recCpu = {
@@ -22,6 +22,11 @@
 #include "microVU.h"
 
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
+
+#define XXH_STATIC_LINKING_ONLY 1
+#define XXH_INLINE_ALL 1
+#include <xxhash.h>
 
 //------------------------------------------------------------------
 // Micro VU - Main Functions
@@ -82,6 +87,8 @@ void mVUreset(microVU& mVU, bool resetReserve)
 	if (resetReserve)
 		mVU.cache_reserve->Reset();
 
+	mVU.useAVX = EmuConfig.Cpu.Recompiler.EnableVUAVX && cpuinfo_has_x86_avx2();
+
 	mode.m_read  = true;
 	mode.m_write = true;
 	mode.m_exec  = false;
@@ -98,6 +105,41 @@ void mVUreset(microVU& mVU, bool resetReserve)
 	vuRegs[mVU.index].nextBlockCycles = 0;
 	memset(&mVU.prog.lpState, 0, sizeof(mVU.prog.lpState));
 
+	// Program Lookup, debug only
+	const microProgStats& stats = mVU.prog.stats;
+	if (EmuConfig.Cpu.Recompiler.EnableVUProgramStats && stats.lookups)
+	{
+		const u64 scans = stats.lookups - stats.hashHits;
+		Console.WriteLn("microVU%u: %llu program lookups, %llu%% by digest, %.1f programs compared per scan, %llu KB compared",
+			mVU.index, static_cast<unsigned long long>(stats.lookups),
+			static_cast<unsigned long long>(stats.hashHits * 100 / stats.lookups),
+			scans ? static_cast<double>(stats.candidates) / scans : 0.0,
+			static_cast<unsigned long long>(stats.compareBytes / 1024));
+	}
+	memset(&mVU.prog.stats, 0, sizeof(mVU.prog.stats));
+
+	// Tiered Compilation
+	const microTierStats& tiers = mVU.prog.tierStats;
+	if (EmuConfig.Cpu.Recompiler.EnableVUTieredCompilation && (tiers.quickBlocks || tiers.fullBlocks))
+	{
+		Console.WriteLn("microVU%u: %llu quick blocks in %.1f ms, %llu full blocks in %.1f ms, %llu tier-ups",
+			mVU.index, static_cast<unsigned long long>(tiers.quickBlocks),
+			Common::Timer::ConvertValueToSeconds(tiers.quickTime) * 1000.0,
+			static_cast<unsigned long long>(tiers.fullBlocks),
+			Common::Timer::ConvertValueToSeconds(tiers.fullTime) * 1000.0,
+			static_cast<unsigned long long>(tiers.tierUps));
+	}
+	memset(&mVU.prog.tierStats, 0, sizeof(mVU.prog.tierStats));
+	mVU.prog.quickTier = false;
+	mVU.prog.tierUp = false;
+	mVU.prog.nestedStart = nullptr;
+	memset(mVU.prog.lineHash, 0, sizeof(mVU.prog.lineHash));
+	mVU.prog.lineDirty = ~0ull;
+	mVU.prog.microHash = 0;
+	if (!mVU.prog.progHash)
+		mVU.prog.progHash = new std::unordered_map<u64, microProgram*>();
+	mVU.prog.progHash->clear();
+
 	// Program Variables
 	mVU.prog.cleared  =  1;
 	mVU.prog.isSame   = -1;
@@ -151,11 +193,23 @@ void mVUclose(microVU& mVU)
 		delete mVU.prog.prog[i];
 		mVU.prog.prog[i] = NULL;
 	}
+
+	delete mVU.prog.progHash;
+	mVU.prog.progHash = NULL;
 }
 
 // Clears Block Data in specified range
 __fi void mVUclear(mV, u32 addr, u32 size)
 {
+	// Callers clear before writing, so digests of the touched lines are recomputed on the next search
+	if (size && addr < mVU.microMemSize)
+	{
+		const u32 first = addr / mVUmicroLineSize;
+		const u32 last  = (std::min(addr + size, mVU.microMemSize) - 1) / mVUmicroLineSize;
+		for (u32 i = first; i <= last; i++)
+			mVU.prog.lineDirty |= 1ull << i;
+	}
+
 	if (!mVU.prog.cleared)
 	{
 		mVU.prog.cleared = 1; // Next execution searches/creates a new microprogram
@@ -236,11 +290,29 @@ u64 mVUrangesHash(microVU& mVU, microProgram& prog)
 	return hash.v64;
 }
 
+// Recomputes digests of micro memory lines written since the last search
+static void mVUupdateMicroHash(microVU& mVU)
+{
+	const u8* micro = vuRegs[mVU.index].Micro;
+	const u32 lines = mVU.microMemSize / mVUmicroLineSize;
+	for (u32 i = 0; i < lines; i++)
+	{
+		if (!(mVU.prog.lineDirty & (1ull << i)))
+			continue;
+		// Seeded by line so the same code at a different address gets a different digest
+		const u64 hash = XXH3_64bits_withSeed(micro + i * mVUmicroLineSize, mVUmicroLineSize, i);
+		mVU.prog.microHash ^= mVU.prog.lineHash[i] ^ hash;
+		mVU.prog.lineHash[i] = hash;
+	}
+	mVU.prog.lineDirty = 0;
+}
+
 // Compare Cached microProgram to vuRegs[mVU.index].Micro
 __fi bool mVUcmpProg(microVU& mVU, microProgram& prog)
 {
 	if (doWholeProgCompare)
 	{
+		mVU.prog.stats.compareBytes += mVU.microMemSize;
 		if (memcmp((u8*)prog.data, vuRegs[mVU.index].Micro, mVU.microMemSize))
 			return false;
 	}
@@ -250,6 +322,7 @@ __fi bool mVUcmpProg(microVU& mVU, microProgram& prog)
 		{
 			auto cmpOffset = [&](void* x) { return (u8*)x + range.start; };
 
+			mVU.prog.stats.compareBytes += range.end - range.start;
 			if (memcmp(cmpOffset(prog.data), cmpOffset(vuRegs[mVU.index].Micro), (range.end - range.start)))
 				return false;
 		}
@@ -269,32 +342,66 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 
 	if (!quick.prog) // If null, we need to search for new program
 	{
-		std::deque<microProgram*>::iterator it(list->begin());
-		for (; it != list->end(); ++it)
+		// The digest map remembers which program matched each micro memory state seen before,
+		// so titles cycling through uploads take one probe and one confirming compare.
+		// Programs only match over their compiled ranges, so on a miss fall back to walking the list.
+		mVUupdateMicroHash(mVU);
+		const u64 key = mVU.prog.microHash ^ (static_cast<u64>(vuRegs[mVU.index].start_pc / 8) * 0x9E3779B97F4A7C15ull);
+		mVU.prog.stats.lookups++;
+
+		microProgram* found = nullptr;
+		auto hit = mVU.prog.progHash->find(key);
+		if (hit != mVU.prog.progHash->end())
 		{
-			bool b = mVUcmpProg(mVU, *it[0]);
-
-			if (b)
+			if (mVUcmpProg(mVU, *hit->second))
+			{
+				found = hit->second;
+				mVU.prog.stats.hashHits++;
+			}
+			else
 			{
-				quick.block = it[0]->block[startPC / 8];
-				quick.prog  = it[0];
-				list->erase(it);
-				list->push_front(quick.prog);
+				mVU.prog.progHash->erase(hit);
+			}
+		}
 
-				// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
-				if (quick.block == nullptr)
+		if (!found)
+		{
+			for (microProgram* prog : *list)
+			{
+				mVU.prog.stats.candidates++;
+				if (mVUcmpProg(mVU, *prog))
 				{
-					void* entryPoint = mVUblockFetch(mVU, startPC, pState);
-					return entryPoint;
+					found = prog;
+					break;
 				}
-				return mVUentryGet(mVU, quick.block, startPC, pState);
 			}
 		}
 
+		if (mVU.prog.progHash->size() >= mVUprogHashMax)
+			mVU.prog.progHash->clear();
+
+		if (found)
+		{
+			(*mVU.prog.progHash)[key] = found;
+			quick.block = found->block[startPC / 8];
+			quick.prog  = found;
+			list->erase(std::find(list->begin(), list->end(), found));
+			list->push_front(found);
+
+			// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
+			if (quick.block == nullptr)
+			{
+				void* entryPoint = mVUblockFetch(mVU, startPC, pState);
+				return entryPoint;
+			}
+			return mVUentryGet(mVU, quick.block, startPC, pState);
+		}
+
 		// If cleared and program not found, make a new program instance
 		mVU.prog.cleared = 0;
 		mVU.prog.isSame  = 1;
 		mVU.prog.cur     = mVUcreateProg(mVU, vuRegs[mVU.index].start_pc/8);
+		(*mVU.prog.progHash)[key] = mVU.prog.cur;
 		void* entryPoint = mVUblockFetch(mVU,  startPC, pState);
 		quick.block      = mVU.prog.cur->block[startPC/8];
 		quick.prog       = mVU.prog.cur;
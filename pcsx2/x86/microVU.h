@@ -16,6 +16,7 @@
 #pragma once
 
 #include <deque>
+#include <unordered_map>
 #include <algorithm>
 #include <cstring> /* memset/memcpy */
 #include <memory>
@@ -28,9 +29,11 @@
 #include "iR5900.h"
 #include "R5900OpcodeTables.h"
 #include "VirtualMemory.h"
+#include "common/Timer.h"
 #include "common/emitter/x86emitter.h"
 #include "microVU_Misc.h"
 #include "microVU_IR.h"
+#include "RecProfiler.h"
 
 class microBlockManager;
 
@@ -70,6 +73,28 @@ struct microProgramQuick
 	microProgram*      prog;  // The microProgram who is the owner of 'block'
 };
 
+static const uint mVUmicroLineSize = 256;                // Granularity of micro memory digests (in bytes)
+static const uint mVUmicroLines    = 0x4000 / mVUmicroLineSize;
+static const uint mVUprogHashMax   = 4096;               // Digest map is flushed when it grows past this
+static_assert(mVUmicroLines <= 64, "Dirty line mask is a u64");
+
+struct microProgStats
+{
+	u64 lookups;      // Program searches after a micro memory change
+	u64 hashHits;     // Searches answered by the digest map
+	u64 candidates;   // Programs compared by the fallback list walk
+	u64 compareBytes; // Bytes compared by mVUcmpProg
+};
+
+struct microTierStats
+{
+	u64 quickBlocks; // Blocks compiled without flag look-ahead or register preloading
+	u64 fullBlocks;  // Blocks compiled with the full optimizer, including tier-ups
+	u64 tierUps;     // Quick blocks which crossed mVUtierThreshold and were replaced
+	u64 quickTime;   // Timer ticks spent compiling each tier (excluding nested compiles)
+	u64 fullTime;
+};
+
 struct microProgManager
 {
 	microIR<mProgSize> IRinfo;             // IR information
@@ -84,11 +109,21 @@ struct microProgManager
 	u8*                x86start;           // Start of program's rec-cache
 	u8*                x86end;             // Limit of program's rec-cache
 	microRegInfo       lpState;            // Pipeline state from where program left off (useful for continuing execution)
+	u64                lineHash[mVUmicroLines]; // Digests of each line of vuRegs[mVU.index].Micro
+	u64                lineDirty;          // Lines written since their digest was last computed
+	u64                microHash;          // Digest of the whole micro memory (xor of lineHash)
+	std::unordered_map<u64, microProgram*>* progHash; // Micro memory digest and startPC -> program that matched it
+	microProgStats     stats;              // Program lookup counters, logged on reset
+	microTierStats     tierStats;          // Tiered compilation counters, logged on reset
+	bool               quickTier;          // Block being compiled is quick tier
+	bool               tierUp;             // Next compile replaces a quick tier block, so uses the full optimizer
+	u8*                nestedStart;        // Start of the first block compiled from inside the block being compiled
 };
 
 static const uint mVUdispCacheSize = __pagesize; // Dispatcher Cache Size (in bytes)
 static const uint mVUcacheSafeZone =  3; // Safe-Zone for program recompilation (in megabytes)
 static const uint mVUcacheReserve = 64; // mVU0, mVU1 Reserve Cache Size (in megabytes)
+static const uint mVUtierThreshold = 32; // Runs of a quick tier block before it's recompiled with full optimizations
 
 struct microVU
 {
@@ -106,6 +141,7 @@ struct microVU
 	u32 progSize;     // VU Micro Memory Size (in u32's)
 	u32 progMemMask;  // VU Micro Memory Size (in u32's)
 	u32 cacheSize;    // VU Cache Size
+	bool useAVX;      // Emit non-destructive VEX forms (EnableVUAVX on an AVX2 host)
 
 	microProgManager               prog;     // Micro Program Data
 	std::unique_ptr<microRegAlloc> regAlloc; // Reg Alloc Class
@@ -244,6 +280,7 @@ extern void mVUclear(mV, u32, u32);
 extern void mVUreset(microVU& mVU, bool resetReserve);
 extern void* mVUblockFetch(microVU& mVU, u32 startPC, uptr pState);
 _mVUt extern void* mVUcompileJIT(u32 startPC, uptr ptr);
+_mVUt extern void* mVUtierUpJIT(u32 startPC, uptr ptr);
 
 // Prototypes for Linux
 extern void mVUcleanUpVU0();
@@ -455,6 +455,7 @@ __fi void mVUinitFirstPass(microVU& mVU, uptr pState, u8* thisPtr)
 		memcpy((u8*)&mVU.prog.lpState, (u8*)pState, sizeof(microRegInfo));
 	}
 	mVUblock.x86ptrStart = thisPtr;
+	mVUblock.tierCount   = mVUtierThreshold;
 	mVUpBlock = mVUblocks[mVUstartPC / 2]->add(mVU, &mVUblock); // Add this block to block manager
 	mVUregs.needExactMatch = (mVUpBlock->pState.blockType) ? 7 : 0; // ToDo: Fix 1-Op block flag linking (MGS2:Demo/Sly Cooper)
 	mVUregs.blockType = 0;
@@ -594,7 +595,29 @@ static void mvuPreloadRegisters(microVU& mVU, u32 endCount)
 	mVU.code = orig_code;
 }
 
-void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
+// Quick tier blocks count down their runs on entry, and once hot are recompiled with the full
+// optimizer. The entry is at a block boundary, so only the status flags and xmmPQ are live.
+static void mVUtierCheck(microVU& mVU, u32 startPC)
+{
+	// Blocks are heap allocated, so they can be out of rip-relative range.
+	xLoadFarAddr(gprT1q, &mVUpBlock->tierCount);
+	xSUB(ptr32[gprT1q], 1);
+	xForwardJump32 skip(Jcc_NotZero);
+
+	mVUbackupRegs(mVU);
+	xMOV(arg1regd, startPC);
+	xLoadFarAddr(arg2reg, mVUpBlock);
+	if (!mVU.index)
+		xFastCall((void*)(void (*)())mVUtierUpJIT<0>, arg1reg, arg2reg); //(u32 startPC, uptr pBlock)
+	else
+		xFastCall((void*)(void (*)())mVUtierUpJIT<1>, arg1reg, arg2reg);
+	mVUrestoreRegs(mVU);
+	xJMP(gprT1q); // Jump to the recompiled block
+
+	skip.SetTarget();
+}
+
+static void* mVUcompileBlock(microVU& mVU, u32 startPC, uptr pState, u32& count)
 {
 	microFlagCycles mFC;
 	u8* thisPtr = x86Ptr;
@@ -744,6 +767,11 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 	mVUregs.vi15v = (doConstProp && mVUconstReg[15].isValid) ? 1 : 0;
 	mVUsetFlags(mVU, mFC);           // Sets Up Flag instances
 	mVUoptimizePipeState(mVU);       // Optimize the End Pipeline State for nicer Block Linking
+	count = mVUcount;
+	if (RecProfiler::IsEnabled())
+		RecProfiler::EmitBlockEntry(isVU1 ? RecProfiler::Cpu::VU1 : RecProfiler::Cpu::VU0, startPC);
+	if (mVU.prog.quickTier)
+		mVUtierCheck(mVU, startPC);
 	mVUtestCycles(mVU, mFC);         // Update VU Cycles and Exit Early if Necessary
 
 	// Second Pass
@@ -752,7 +780,8 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 	mVUbranch = 0;
 	u32 x = 0;
 
-	mvuPreloadRegisters(mVU, endCount);
+	if (!mVU.prog.quickTier)
+		mvuPreloadRegisters(mVU, endCount);
 
 	for (; x < endCount; x++)
 	{
@@ -869,6 +898,48 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 	return thisPtr;
 }
 
+void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
+{
+	// Blocks start out in the quick tier, unless this is a tier-up. Only the first pass and the
+	// register preload look at quickTier, and both finish before any nested compile of a successor.
+	const bool full = mVU.prog.tierUp || !EmuConfig.Cpu.Recompiler.EnableVUTieredCompilation;
+	mVU.prog.tierUp = false;
+	mVU.prog.quickTier = !full;
+
+	microTierStats& stats = mVU.prog.tierStats;
+	const u64 nested_before = stats.quickTime + stats.fullTime;
+	const u64 start = Common::Timer::GetCurrentValue();
+
+	// Successor blocks compiled from inside this one are placed right after its code
+	u8* const outer_nested = mVU.prog.nestedStart;
+	mVU.prog.nestedStart = nullptr;
+
+	u32 count = 0;
+	void* ptr = mVUcompileBlock(mVU, startPC, pState, count);
+
+	if (RecProfiler::IsEnabled())
+	{
+		const u8* end = mVU.prog.nestedStart ? mVU.prog.nestedStart : xGetPtr();
+		RecProfiler::RegisterBlock(isVU1 ? RecProfiler::Cpu::VU1 : RecProfiler::Cpu::VU0, startPC, count, ptr,
+			static_cast<u32>(end - static_cast<u8*>(ptr)));
+	}
+	mVU.prog.nestedStart = outer_nested ? outer_nested : static_cast<u8*>(ptr);
+
+	// Nested compiles of successor blocks have already added their own time
+	const u64 elapsed = (Common::Timer::GetCurrentValue() - start) - (stats.quickTime + stats.fullTime - nested_before);
+	if (full)
+	{
+		stats.fullBlocks++;
+		stats.fullTime += elapsed;
+	}
+	else
+	{
+		stats.quickBlocks++;
+		stats.quickTime += elapsed;
+	}
+	return ptr;
+}
+
 // Returns the entry point of the block (compiles it if not found)
 __fi void* mVUentryGet(microVU& mVU, microBlockManager* block, u32 startPC, uptr pState)
 {
@@ -924,3 +995,32 @@ _mVUt void* mVUcompileJIT(u32 startPC, uptr ptr)
 		return mVUsearchProg<vuIndex>(startPC, ptr); // Find and set correct program
 	}
 }
+
+// mVUtierUpJIT() - Called from the entry of a quick tier block once it has run mVUtierThreshold times
+_mVUt void* mVUtierUpJIT(u32 startPC, uptr ptr)
+{
+	microVU& mVU = mVUx;
+	microBlock* pBlock = (microBlock*)ptr;
+	u8* oldPtr = pBlock->x86ptrStart;
+
+	// The jump cache was filled for the quick block's end state, which the new block won't share
+	delete[] pBlock->jumpCache;
+	pBlock->jumpCache = nullptr;
+
+	// mVUcompile finds this block again through its pipeline state, so point it at the new code
+	// first, letting the block branch to itself directly.
+	pBlock->x86ptrStart = xGetPtr();
+	mVU.prog.tierUp = true;
+	u8* newPtr = (u8*)mVUcompile(mVU, startPC, (uptr)&pBlock->pState);
+	pBlock->x86ptrStart = newPtr;
+	mVU.prog.tierStats.tierUps++;
+
+	// Existing links still jump to the quick block, so redirect its entry. The tier check
+	// at the start of the old code is always longer than the jump written over it.
+	u8* curPtr = xGetPtr();
+	xSetPtr(oldPtr);
+	xJMP(newPtr);
+	xSetPtr(curPtr);
+
+	return newPtr;
+}
@@ -180,7 +180,7 @@ __fi void mVUsetFlags(mV, microFlagCycles& mFC)
 	iPC = mVUstartPC;
 	for (mVUcount = 0; mVUcount < xCount; mVUcount++)
 	{
-		if (mVUlow.isFSSET && !noFlagOpts)
+		if (mVUlow.isFSSET && !noFlagOpts && !mVU.prog.quickTier)
 		{
 			if (__Status) // Don't Optimize out on the last ~4+ instructions
 			{
@@ -211,7 +211,7 @@ __fi void mVUsetFlags(mV, microFlagCycles& mFC)
 
 		if (sFLAG.doFlag)
 		{
-			if (noFlagOpts)
+			if (noFlagOpts || mVU.prog.quickTier)
 			{
 				sFLAG.doNonSticky = true;
 				mFLAG.doFlag = true;
@@ -414,7 +414,9 @@ void mVUflagPass(mV, u32 startPC, u32 sCount = 0, u32 found = 0)
 // Checks if the first ~4 instructions of a block will read flags
 void mVUsetFlagInfo(mV)
 {
-	if (noFlagOpts)
+	// Quick tier blocks skip the look-ahead into the following blocks, and just
+	// pass every flag instance on to them.
+	if (noFlagOpts || mVU.prog.quickTier)
 	{
 		mVUregs.needExactMatch = 0x7;
 		mVUregs.flagInfo = 0x0;
@@ -349,6 +349,23 @@ void MIN_MAX_PS(microVU& mVU, const xmm& to, const xmm& from, const xmm& t1in, c
 	const xmm& t2 = t2in.IsEmpty() ? mVU.regAlloc->allocReg() : t2in;
 
 	// use integer comparison
+	if (mVU.useAVX)
+	{
+		const xmm& c1 = min ? t2 : t1;
+		const xmm& c2 = min ? t1 : t2;
+
+		xVPSRAD    (t1, to, 31);
+		xVPSRLD    (t1, t1,  1);
+		xVPXOR     (t1, t1, to);
+
+		xVPSRAD    (t2, from, 31);
+		xVPSRLD    (t2, t2,  1);
+		xVPXOR     (t2, t2, from);
+
+		xVPCMP.GTD (c1, c1, c2);
+		xVBLENDVPS (to, from, to, c1);
+	}
+	else
 	{
 		const xmm& c1 = min ? t2 : t1;
 		const xmm& c2 = min ? t1 : t2;
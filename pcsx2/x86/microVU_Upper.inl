@@ -228,6 +228,18 @@ static void setupFtReg(microVU& mVU, xmm& Ft, xmm& tempFt, int opCase, int clamp
 	}
 }
 
+// Full vector ADD/SUB/MUL to a VF reg can use a three-operand VEX form, which leaves Fs
+// as a read-only cached reg instead of cloning it. Not possible when Fs has to be clamped.
+static bool mVUcanUseVEX(microVU& mVU, int opType, bool isACC, int clampType)
+{
+	if (!mVU.useAVX || isACC || clampE || (_X_Y_Z_W != 0xf) || !_Fd_)
+		return false;
+	if ((opType > 2) && (opType != 5)) // Min/Max have their own AVX path
+		return false;
+	// Based on mVUclamp2 -> mVUclamp1.
+	return !((clampType & cFs) && (CHECK_VU_OVERFLOW(mVU.index) || CHECK_VU_SIGN_OVERFLOW(mVU.index)));
+}
+
 // Normal FMAC Opcodes
 static void mVU_FMACa(microVU& mVU, int recPass, int opCase, int opType, bool isACC, int clampType)
 {
@@ -240,6 +252,24 @@ static void mVU_FMACa(microVU& mVU, int recPass, int opCase, int opType, bool is
 		xmm Fs, Ft, ACC, tempFt;
 		setupFtReg(mVU, Ft, tempFt, opCase, clampType);
 
+		if (mVUcanUseVEX(mVU, opType, isACC, clampType))
+		{
+			Fs = mVU.regAlloc->allocReg(_Fs_);
+			const xmm& Fd = mVU.regAlloc->allocReg(-1, _Fd_, 0xf);
+
+			if (clampType & cFt) mVUclamp2(mVU, Ft, xEmptyReg, 0xf);
+
+			if      (opType == 1) xVSUB.PS(Fd, Fs, Ft);
+			else if (opType == 2) xVMUL.PS(Fd, Fs, Ft);
+			else                  xVADD.PS(Fd, Fs, Ft);
+
+			mVUupdateFlags(mVU, Fd, tempFt);
+			mVU.regAlloc->clearNeeded(Fd); // Always Clear Written Reg First
+			mVU.regAlloc->clearNeeded(Fs);
+			mVU.regAlloc->clearNeeded(Ft);
+			return;
+		}
+
 		if (isACC)
 		{
 			Fs = mVU.regAlloc->allocReg(_Fs_, 0, _X_Y_Z_W);
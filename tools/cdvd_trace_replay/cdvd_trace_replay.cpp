@@ -0,0 +1,290 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: LGPL-3.0+
+
+// Replays a CDVD read trace against one or more disc images and reports read latency.
+// Reads go through InputIsoFile and the emulator's own file readers, so prefetch, preload, the
+// readahead buffers and the background gzip index behave the same as in a game.
+
+#include "CDVD/CDVD.h"
+#include "CDVD/IsoFileFormats.h"
+#include "Config.h"
+#include "Host.h"
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/StringUtil.h"
+#include "common/Timer.h"
+
+#include <libretro.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+// --------------------------------------------------------------------------------------
+//  Frontend stubs
+// --------------------------------------------------------------------------------------
+// The readers only need logging, OSD messages and the gzip index location from the frontend.
+
+static bool s_verbose = false;
+
+static void RETRO_CALLCONV ReplayLog(enum retro_log_level level, const char* fmt, ...)
+{
+	if (level < RETRO_LOG_WARN && !s_verbose)
+		return;
+
+	std::va_list ap;
+	va_start(ap, fmt);
+	std::vfprintf(stderr, fmt, ap);
+	va_end(ap);
+}
+
+retro_log_printf_t log_cb = ReplayLog;
+
+namespace EmuFolders
+{
+	std::string DataRoot;
+} // namespace EmuFolders
+
+std::string Host::GetBaseStringSettingValue(const char* section, const char* key, const char* default_value)
+{
+	return default_value;
+}
+
+void Host::AddOSDMessage(std::string message, float duration)
+{
+	if (s_verbose)
+		std::fprintf(stderr, "%s\n", message.c_str());
+}
+
+// --------------------------------------------------------------------------------------
+//  Trace replay
+// --------------------------------------------------------------------------------------
+
+static constexpr const char* USAGE = R"(Usage: cdvd_trace_replay [options] <trace> <image> [image...]
+
+Replays a CDVD read trace against one or more disc images and reports read latency.
+Traces are recorded by enabling CdvdTrace (the "Record Disc Read Trace" core option), and are
+written to the cache folder. The same trace can be replayed against several encodings of one
+game to compare them.
+
+Options:
+  --realtime         Issue requests at their emulated time instead of back to back, so background
+                     prefetch gets the time to run that it has in a game.
+  --preload          Preload each image into memory first, as the CdvdPreload option does.
+  --cache-size SIZE  Size of each of the reader's two readahead buffers, e.g. 512K or 4M. This is
+                     also how far it reads ahead. Default and minimum: 128K.
+  --prefetch SIZE    Most that's prefetched at once, for the rest of a file or after a seek.
+                     0 disables prefetching. Default: 32M.
+  --verbose          Show reader log and OSD messages.
+
+Sizes take a K, M or G suffix. Flat images are memory-mapped, so the cache size only affects
+compressed formats.
+
+Example usage:
+  cdvd_trace_replay --realtime --cache-size 1M cdvd_game.iso_1700000000.trace game.iso game.chd game.gz
+)";
+
+struct TraceRecord
+{
+	char type;
+	u64 cycle;
+	u32 lsn;
+	u32 count;
+	int mode;
+};
+
+static bool ReadTrace(const char* path, u64* clock, std::vector<TraceRecord>* records)
+{
+	std::optional<std::string> data = FileSystem::ReadFileToString(path);
+	if (!data.has_value())
+		return false;
+
+	*clock = 36864000;
+	for (const std::string_view& line : StringUtil::SplitString(data.value(), '\n'))
+	{
+		if (line.empty())
+			continue;
+
+		if (line[0] == '#')
+		{
+			const std::string_view::size_type pos = line.find("clock=");
+			if (pos != std::string_view::npos)
+				*clock = std::strtoull(std::string(line.substr(pos + 6)).c_str(), nullptr, 10);
+			continue;
+		}
+
+		TraceRecord record;
+		unsigned long long cycle;
+		if (std::sscanf(std::string(line).c_str(), "%c,%llu,%u,%u,%d", &record.type, &cycle, &record.lsn, &record.count, &record.mode) != 5)
+			continue;
+		record.cycle = cycle;
+		records->push_back(record);
+	}
+
+	return true;
+}
+
+static bool ParseSize(const char* str, u32* size)
+{
+	char* end;
+	u64 value = std::strtoull(str, &end, 10);
+	if (end == str)
+		return false;
+
+	switch (*end)
+	{
+		case 'k': case 'K': value *= _1kb; end++; break;
+		case 'm': case 'M': value *= _1mb; end++; break;
+		case 'g': case 'G': value *= _1gb; end++; break;
+		default: break;
+	}
+	if (*end != '\0' || value > std::numeric_limits<u32>::max())
+		return false;
+
+	*size = static_cast<u32>(value);
+	return true;
+}
+
+static double Percentile(std::vector<double> values, u32 p)
+{
+	if (values.empty())
+		return 0.0;
+
+	const size_t index = std::min(values.size() - 1, values.size() * p / 100);
+	std::nth_element(values.begin(), values.begin() + index, values.end());
+	return values[index];
+}
+
+static void Replay(const char* path, u64 clock, const std::vector<TraceRecord>& records, bool realtime, bool preload,
+	u32 cache_size, u32 prefetch_budget)
+{
+	const std::string name(Path::GetFileName(path));
+
+	InputIsoFile iso;
+	iso.SetReadSettings(cache_size, prefetch_budget);
+	const u64 open_start = Common::Timer::GetCurrentValue();
+	if (!iso.Open(path, preload))
+	{
+		std::printf("%s: failed to open image\n", name.c_str());
+		return;
+	}
+	const double open_time = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - open_start);
+
+	std::vector<double> latencies;
+	latencies.reserve(records.size());
+	u8 buffer[CD_FRAMESIZE_RAW];
+
+	const u64 first_cycle = records.front().cycle;
+	const auto replay_start = std::chrono::steady_clock::now();
+	for (const TraceRecord& record : records)
+	{
+		if (realtime)
+		{
+			const double emulated = static_cast<double>(record.cycle - first_cycle) / static_cast<double>(clock);
+			std::this_thread::sleep_until(replay_start + std::chrono::duration<double>(emulated));
+		}
+
+		// Same as the ISO plugin, see CDVDisoReader.cpp.
+		if (record.type == 'P')
+		{
+			iso.Prefetch(record.lsn, record.count);
+			continue;
+		}
+		if (record.lsn >= iso.GetBlockCount())
+			continue;
+
+		const u64 start = Common::Timer::GetCurrentValue();
+		if (record.type == 'R')
+		{
+			iso.BeginRead2(record.lsn);
+			iso.FinishRead3(buffer, record.mode);
+		}
+		else
+		{
+			iso.ReadSync(buffer, record.lsn);
+		}
+		latencies.push_back(Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start));
+	}
+
+	const u32 cache = iso.GetCacheSize();
+	iso.Close();
+
+	if (latencies.empty())
+	{
+		std::printf("%s: no reads inside the image\n", name.c_str());
+		return;
+	}
+
+	double total = 0.0;
+	for (const double latency : latencies)
+		total += latency;
+	const double throughput = (total > 0.0) ? (latencies.size() * 2048.0 / total / _1mb) : 0.0;
+	std::printf("%s: cache 2x%uK, prefetch %uK, open %.1fms, p50 %.1fus, p99 %.1fus, max %.1fus, %.1f MB/s\n",
+		name.c_str(), static_cast<u32>(cache / _1kb), static_cast<u32>(prefetch_budget / _1kb), open_time * 1e3, Percentile(latencies, 50) * 1e6,
+		Percentile(latencies, 99) * 1e6, *std::max_element(latencies.begin(), latencies.end()) * 1e6, throughput);
+}
+
+int main(int argc, char* argv[])
+{
+	bool realtime = false;
+	bool preload = false;
+	u32 cache_size = 0;
+	u32 prefetch_budget = 32 * _1mb;
+	std::vector<const char*> paths;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--realtime") == 0)
+			realtime = true;
+		else if (std::strcmp(argv[i], "--preload") == 0)
+			preload = true;
+		else if (std::strcmp(argv[i], "--verbose") == 0)
+			s_verbose = true;
+		else if (std::strcmp(argv[i], "--cache-size") == 0 && i + 1 < argc && ParseSize(argv[i + 1], &cache_size))
+			i++;
+		else if (std::strcmp(argv[i], "--prefetch") == 0 && i + 1 < argc && ParseSize(argv[i + 1], &prefetch_budget))
+			i++;
+		else if (argv[i][0] == '-')
+		{
+			std::fputs(USAGE, stderr);
+			return EXIT_FAILURE;
+		}
+		else
+			paths.push_back(argv[i]);
+	}
+
+	if (paths.size() < 2)
+	{
+		std::fputs(USAGE, stderr);
+		return EXIT_FAILURE;
+	}
+
+	u64 clock;
+	std::vector<TraceRecord> records;
+	if (!ReadTrace(paths[0], &clock, &records))
+	{
+		std::fprintf(stderr, "Failed to read trace '%s'.\n", paths[0]);
+		return EXIT_FAILURE;
+	}
+
+	const size_t reads = std::count_if(records.begin(), records.end(), [](const TraceRecord& r) { return r.type != 'P'; });
+	if (reads == 0)
+	{
+		std::fprintf(stderr, "Trace has no reads.\n");
+		return EXIT_FAILURE;
+	}
+	std::printf("%zu sector reads, %zu seeks over %.1fs of emulated time.\n", reads, records.size() - reads,
+		static_cast<double>(records.back().cycle - records.front().cycle) / static_cast<double>(clock));
+
+	for (size_t i = 1; i < paths.size(); i++)
+		Replay(paths[i], clock, records, realtime, preload, cache_size, prefetch_budget);
+
+	return EXIT_SUCCESS;
+}
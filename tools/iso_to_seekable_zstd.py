@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+
+import sys
+import os
+import struct
+import argparse
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
+
+import zstandard
+
+# PCSX2 - PS2 Emulator for PCs
+# Copyright (C) 2002-2024  PCSX2 Dev Team
+#
+# PCSX2 is free software: you can redistribute it and/or modify it under the terms
+# of the GNU Lesser General Public License as published by the Free Software Found-
+# ation, either version 3 of the License, or (at your option) any later version.
+#
+# PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+# PURPOSE.  See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with PCSX2.
+# If not, see <http://www.gnu.org/licenses/>.
+
+
+DESCRIPTION = """Converts a disc image to the seekable zstd format read by ZstdFileReader.
+The image is split into independently compressed frames, followed by a seek table as described in
+https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+Optionally, a dictionary is trained on a sample of frames and stored in a skippable frame at the
+start of the file, which improves the ratio of small frames.
+
+Example usage:
+  python3 iso_to_seekable_zstd.py game.iso game.zst
+  python3 iso_to_seekable_zstd.py --level 19 --frame-size 65536 --dictionary game.iso game.zst
+
+Requires the zstandard module (pip install zstandard)."""
+
+SEEKABLE_MAGIC = 0x8F92EAB1
+SEEK_TABLE_MAGIC = 0x184D2A5E
+# Must match ZSTD_DICTIONARY_MAGIC in pcsx2/CDVD/ZstdFileReader.cpp
+DICTIONARY_MAGIC = 0x184D2A5D
+
+SECTOR_SIZE = 2048
+# Must match ZSTD_MAX_FRAME_SIZE in pcsx2/CDVD/ZstdFileReader.cpp
+MAX_FRAME_SIZE = 16 * 1024 * 1024
+
+
+def read_frames(path, frame_size):
+    with open(path, "rb") as f:
+        while True:
+            data = f.read(frame_size)
+            if not data:
+                break
+            yield data
+
+
+def train_dictionary(path, frame_size, dict_size):
+    # Sample evenly across the disc rather than just the start, which is mostly system files.
+    total = os.path.getsize(path)
+    count = min(max(total // frame_size, 1), 2048)
+    stride = max(total // count, frame_size)
+    samples = []
+    with open(path, "rb") as f:
+        for i in range(count):
+            f.seek(i * stride)
+            data = f.read(frame_size)
+            if data:
+                samples.append(data)
+    return zstandard.train_dictionary(dict_size, samples)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=DESCRIPTION, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="Uncompressed disc image")
+    parser.add_argument("output", help="Seekable zstd image to write")
+    parser.add_argument("--level", type=int, default=19, help="zstd compression level (default: 19)")
+    parser.add_argument("--frame-size", type=int, default=128 * 1024, help="Uncompressed bytes per frame, a multiple of 2048 (default: 131072)")
+    parser.add_argument("--dictionary", action="store_true", help="Train and embed a dictionary")
+    parser.add_argument("--dictionary-size", type=int, default=112640, help="Dictionary size in bytes (default: 112640)")
+    parser.add_argument("--threads", type=int, default=os.cpu_count(), help="Compression threads (default: all)")
+    args = parser.parse_args()
+
+    if args.frame_size <= 0 or args.frame_size % SECTOR_SIZE != 0 or args.frame_size > MAX_FRAME_SIZE:
+        sys.exit(f"Frame size must be a multiple of {SECTOR_SIZE} up to {MAX_FRAME_SIZE}.")
+
+    dict_data = None
+    if args.dictionary:
+        print("Training dictionary...")
+        dict_data = train_dictionary(args.input, args.frame_size, args.dictionary_size)
+
+    def compress(data):
+        # Compressors aren't thread safe, so each frame gets its own.
+        cctx = zstandard.ZstdCompressor(level=args.level, dict_data=dict_data, write_content_size=True)
+        return len(data), cctx.compress(data)
+
+    entries = []
+    total = os.path.getsize(args.input)
+    done = 0
+    with open(args.output, "wb") as out:
+        if dict_data is not None:
+            raw = dict_data.as_bytes()
+            out.write(struct.pack("<II", DICTIONARY_MAGIC, len(raw)))
+            out.write(raw)
+
+        def write_frame(future):
+            nonlocal done
+            size, compressed = future.result()
+            out.write(compressed)
+            entries.append((len(compressed), size))
+            done += size
+            print(f"\r{done * 100 // max(total, 1)}%", end="", flush=True)
+
+        # Bound the number of frames in flight, so we don't read the whole image into memory.
+        threads = max(args.threads or 1, 1)
+        pending = deque()
+        with ThreadPoolExecutor(max_workers=threads) as pool:
+            for data in read_frames(args.input, args.frame_size):
+                pending.append(pool.submit(compress, data))
+                if len(pending) >= threads * 4:
+                    write_frame(pending.popleft())
+            while pending:
+                write_frame(pending.popleft())
+        print()
+
+        table = b"".join(struct.pack("<II", c, u) for c, u in entries)
+        footer = struct.pack("<IBI", len(entries), 0, SEEKABLE_MAGIC)
+        out.write(struct.pack("<II", SEEK_TABLE_MAGIC, len(table) + len(footer)))
+        out.write(table)
+        out.write(footer)
+
+        print(f"Wrote {len(entries)} frames, {out.tell()} bytes ({out.tell() * 100 // max(total, 1)}% of original).")
+
+
+if __name__ == "__main__":
+    main()